@@ -0,0 +1,463 @@
+#ifndef DSA_BENCHMARK_H
+#define DSA_BENCHMARK_H
+
+// Minimal, dependency-free benchmark harness shared by dsa_benchmark.c++ and
+// scheduling_benchmark.c++. Each benchmark program is a single translation
+// unit, so the allocation hooks below are defined directly in this header.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <chrono>
+#include <random>
+#include <atomic>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <new>
+#include <sys/resource.h>
+using namespace std;
+
+// ==================== ALLOCATION TRACKING ====================
+// Every global new/delete is counted, including the align_val_t overloads used
+// by over-aligned types. The 16 bytes just before each block keep its size and
+// its offset from the start of the underlying allocation, so live and peak
+// heap bytes can be tracked without a side table.
+struct AllocStats {
+    atomic<uint64_t> allocations{0};
+    atomic<uint64_t> bytes{0};
+    atomic<int64_t> live{0};
+    atomic<int64_t> peakLive{0};
+};
+
+static AllocStats allocStats;
+
+static const size_t ALLOC_HEADER = 16;
+
+inline void* countedAlloc(size_t size, size_t alignment = ALLOC_HEADER) {
+    // The header must not disturb the alignment, so it grows to one full unit
+    size_t offset = max(ALLOC_HEADER, alignment);
+    void* block;
+    if (alignment <= ALLOC_HEADER) {
+        block = malloc(size + offset);
+    } else {
+        size_t total = (size + offset + alignment - 1) / alignment * alignment;
+        block = aligned_alloc(alignment, total);
+    }
+    if (!block) throw bad_alloc();
+    char* ptr = (char*)block + offset;
+    ((size_t*)ptr)[-2] = size;
+    ((size_t*)ptr)[-1] = offset;
+    allocStats.allocations.fetch_add(1, memory_order_relaxed);
+    allocStats.bytes.fetch_add(size, memory_order_relaxed);
+    int64_t live = allocStats.live.fetch_add(size, memory_order_relaxed) + size;
+    int64_t peak = allocStats.peakLive.load(memory_order_relaxed);
+    while (live > peak && !allocStats.peakLive.compare_exchange_weak(peak, live, memory_order_relaxed)) {
+    }
+    return ptr;
+}
+
+inline void countedFree(void* ptr) {
+    if (!ptr) return;
+    size_t size = ((size_t*)ptr)[-2];
+    size_t offset = ((size_t*)ptr)[-1];
+    allocStats.live.fetch_sub(size, memory_order_relaxed);
+    free((char*)ptr - offset);
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { countedFree(ptr); }
+
+void* operator new(size_t size, align_val_t al) { return countedAlloc(size, (size_t)al); }
+void* operator new[](size_t size, align_val_t al) { return countedAlloc(size, (size_t)al); }
+void operator delete(void* ptr, align_val_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, align_val_t) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t, align_val_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t, align_val_t) noexcept { countedFree(ptr); }
+
+// ==================== PEAK RSS ====================
+// On Linux writing "5" to clear_refs resets VmHWM, which gives a per-benchmark
+// peak. Elsewhere this falls back to the process-wide getrusage() peak.
+inline void resetPeakRss() {
+    FILE* f = fopen("/proc/self/clear_refs", "w");
+    if (f) {
+        fputs("5", f);
+        fclose(f);
+    }
+}
+
+inline long peakRssKb() {
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return atol(line.c_str() + 6);
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// ==================== INPUT DISTRIBUTIONS ====================
+enum class Distribution {
+    RANDOM,
+    SORTED,
+    REVERSE_SORTED,
+    DUPLICATE_HEAVY,
+    SKEWED           // Skewed graph degree (a few hub vertices)
+};
+
+inline string distributionName(Distribution d) {
+    switch (d) {
+        case Distribution::RANDOM: return "random";
+        case Distribution::SORTED: return "sorted";
+        case Distribution::REVERSE_SORTED: return "reverse";
+        case Distribution::DUPLICATE_HEAVY: return "duplicates";
+        case Distribution::SKEWED: return "skewed";
+    }
+    return "";
+}
+
+// n keys following the distribution; fixed seed so runs are comparable
+inline vector<int> generateKeys(size_t n, Distribution d, unsigned seed = 42) {
+    vector<int> keys(n);
+    mt19937 rng(seed);
+    switch (d) {
+        case Distribution::SORTED:
+            for (size_t i = 0; i < n; i++) keys[i] = (int)i;
+            break;
+        case Distribution::REVERSE_SORTED:
+            for (size_t i = 0; i < n; i++) keys[i] = (int)(n - i);
+            break;
+        case Distribution::DUPLICATE_HEAVY:
+            for (size_t i = 0; i < n; i++) keys[i] = rng() % 16;
+            break;
+        default:
+            for (size_t i = 0; i < n; i++) keys[i] = (int)(rng() & 0x7fffffff);
+            break;
+    }
+    return keys;
+}
+
+// ==================== BENCHMARK STATE ====================
+struct Measurement {
+    string benchmark;
+    string distribution;
+    size_t n;
+    int reps;
+    uint64_t ops;
+    double nsPerOp;
+    double opsPerSec;
+    long peakRssKb;
+    int64_t peakHeapBytes;
+    uint64_t allocations;
+    uint64_t bytesAllocated;
+    vector<pair<string, uint64_t>> counters;
+    vector<pair<string, double>> metrics;
+};
+
+// Redirects cout while a benchmark runs, so printing APIs can be timed
+// without flooding the terminal
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+class BenchState {
+private:
+    chrono::nanoseconds elapsed;
+    NullBuffer nullBuffer;
+
+public:
+    size_t n;
+    Distribution distribution;
+    uint64_t ops;
+    vector<pair<string, double>> metrics;   // Extra per-run results, e.g. latency percentiles
+
+    BenchState(size_t size, Distribution d) : elapsed(0), n(size), distribution(d), ops(0) {}
+
+    // Only the work inside f is timed; setup outside it is free
+    template<typename F>
+    void time(F&& f) {
+        streambuf* saved = cout.rdbuf(&nullBuffer);
+        auto start = chrono::steady_clock::now();
+        f();
+        elapsed += chrono::steady_clock::now() - start;
+        cout.rdbuf(saved);
+    }
+
+    double elapsedNs() const {
+        return (double)elapsed.count();
+    }
+
+    // Reported metrics are averaged over repetitions
+    void report(const string& name, double value) {
+        metrics.push_back({name, value});
+    }
+};
+
+struct Benchmark {
+    string name;
+    vector<Distribution> distributions;
+    function<size_t(Distribution)> maxN;   // Largest size that finishes in reasonable time
+    function<void(BenchState&)> body;
+    // Optional, run once per (n, distribution) outside every measurement,
+    // including peak RSS and heap: e.g. writing an input file
+    function<void(size_t, Distribution)> setup = nullptr;
+    function<void()> teardown = nullptr;
+};
+
+// Hot-path counters exposed by the code under test (optional)
+typedef function<vector<pair<string, uint64_t>>()> CounterReader;
+
+// Keeps results of timed loops observable so the optimizer cannot drop them
+static volatile int64_t benchmarkSink;
+
+inline void consume(int64_t value) {
+    benchmarkSink = value;
+}
+
+// ==================== RUNNER ====================
+struct BenchOptions {
+    size_t minN = 1000;
+    size_t maxN = 1000000;
+    double minTime = 0.1;       // Seconds per measurement before we stop repeating
+    string filter;
+    string jsonPath;
+    string label;
+    string baselinePath;
+    double threshold = 10.0;    // Percent slowdown reported as a regression
+};
+
+inline void printUsage(const char* program) {
+    cout << "Usage: " << program << " [--min N] [--max N] [--min-time SEC] [--filter NAME]\n"
+         << "       [--json FILE] [--label TEXT] [--baseline FILE] [--threshold PCT]" << endl;
+}
+
+// Sizes step by powers of ten from --min, so 0 would never advance, and
+// values beyond size_t cannot be converted
+inline bool parseSize(const string& text, size_t& size) {
+    double value = atof(text.c_str());
+    if (!(value >= 1 && value <= 1e18)) {
+        cout << "Size must be between 1 and 1e18: " << text << endl;
+        return false;
+    }
+    size = (size_t)value;
+    return true;
+}
+
+inline bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage(argv[0]);
+            return false;
+        }
+        string value = argv[++i];
+        bool valid = true;
+        if (arg == "--min") valid = parseSize(value, options.minN);
+        else if (arg == "--max") valid = parseSize(value, options.maxN);
+        else if (arg == "--min-time") options.minTime = atof(value.c_str());
+        else if (arg == "--filter") options.filter = value;
+        else if (arg == "--json") options.jsonPath = value;
+        else if (arg == "--label") options.label = value;
+        else if (arg == "--baseline") options.baselinePath = value;
+        else if (arg == "--threshold") options.threshold = atof(value.c_str());
+        else {
+            printUsage(argv[0]);
+            return false;
+        }
+        if (!valid) return false;
+    }
+    return true;
+}
+
+inline Measurement runOne(const Benchmark& bench, size_t n, Distribution d,
+                          const BenchOptions& options, const CounterReader& counters) {
+    Measurement m;
+    m.benchmark = bench.name;
+    m.distribution = distributionName(d);
+    m.n = n;
+    m.reps = 0;
+    m.ops = 0;
+
+    if (bench.setup) bench.setup(n, d);
+    vector<pair<string, uint64_t>> countersBefore;
+    if (counters) countersBefore = counters();
+    resetPeakRss();
+    uint64_t allocationsBefore = allocStats.allocations.load();
+    uint64_t bytesBefore = allocStats.bytes.load();
+    int64_t liveBefore = allocStats.live.load();
+    allocStats.peakLive.store(liveBefore);
+
+    double totalNs = 0;
+    while (m.reps == 0 || (totalNs < options.minTime * 1e9 && m.reps < 1000)) {
+        BenchState state(n, d);
+        bench.body(state);
+        totalNs += state.elapsedNs();
+        m.ops += state.ops;
+        m.reps++;
+        if (m.metrics.empty()) {
+            for (const auto& metric : state.metrics) m.metrics.push_back({metric.first, 0});
+        }
+        for (size_t i = 0; i < m.metrics.size() && i < state.metrics.size(); i++) {
+            m.metrics[i].second += state.metrics[i].second;
+        }
+    }
+    for (auto& metric : m.metrics) metric.second /= m.reps;
+    if (bench.teardown) bench.teardown();
+
+    m.nsPerOp = m.ops ? totalNs / m.ops : 0;
+    m.opsPerSec = totalNs > 0 ? m.ops * 1e9 / totalNs : 0;
+    m.peakRssKb = peakRssKb();
+    m.peakHeapBytes = allocStats.peakLive.load() - liveBefore;
+    m.allocations = (allocStats.allocations.load() - allocationsBefore) / m.reps;
+    m.bytesAllocated = (allocStats.bytes.load() - bytesBefore) / m.reps;
+    if (counters) {
+        m.counters = counters();
+        for (size_t i = 0; i < m.counters.size(); i++) {
+            m.counters[i].second = (m.counters[i].second - countersBefore[i].second) / m.reps;
+        }
+    }
+    return m;
+}
+
+inline string jsonRecord(const Measurement& m) {
+    ostringstream out;
+    out << "{\"benchmark\":\"" << m.benchmark << "\",\"distribution\":\"" << m.distribution
+        << "\",\"n\":" << m.n << ",\"reps\":" << m.reps << ",\"ns_per_op\":" << m.nsPerOp
+        << ",\"ops_per_sec\":" << m.opsPerSec << ",\"peak_rss_kb\":" << m.peakRssKb
+        << ",\"peak_heap_bytes\":" << m.peakHeapBytes << ",\"allocations\":" << m.allocations
+        << ",\"bytes_allocated\":" << m.bytesAllocated << ",\"counters\":{";
+    for (size_t i = 0; i < m.counters.size(); i++) {
+        out << (i ? "," : "") << "\"" << m.counters[i].first << "\":" << m.counters[i].second;
+    }
+    out << "},\"metrics\":{";
+    for (size_t i = 0; i < m.metrics.size(); i++) {
+        out << (i ? "," : "") << "\"" << m.metrics[i].first << "\":" << m.metrics[i].second;
+    }
+    out << "}}";
+    return out.str();
+}
+
+// Quotes, backslashes and control characters escaped for a JSON string
+inline string jsonEscape(const string& text) {
+    ostringstream out;
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (c < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", c);
+            out << code;
+        } else {
+            out << c;
+        }
+    }
+    return out.str();
+}
+
+// Extracts a scalar field from one of our own single-line JSON records
+inline string jsonField(const string& record, const string& key) {
+    string pattern = "\"" + key + "\":";
+    size_t pos = record.find(pattern);
+    if (pos == string::npos) return "";
+    pos += pattern.size();
+    if (record[pos] == '"') {
+        size_t end = record.find('"', pos + 1);
+        return record.substr(pos + 1, end - pos - 1);
+    }
+    size_t end = record.find_first_of(",}", pos);
+    return record.substr(pos, end - pos);
+}
+
+// Compares ns/op against a previous JSON run; returns the number of regressions
+inline int compareWithBaseline(const vector<Measurement>& results, const BenchOptions& options) {
+    ifstream in(options.baselinePath);
+    if (!in) {
+        cout << "Cannot open baseline: " << options.baselinePath << endl;
+        return 0;
+    }
+    vector<string> baseline;
+    string line;
+    while (getline(in, line)) {
+        if (line.find("{\"benchmark\":") != string::npos) baseline.push_back(line);
+    }
+
+    int regressions = 0;
+    cout << "\nComparison with baseline " << options.baselinePath << ":" << endl;
+    for (const auto& m : results) {
+        for (const auto& record : baseline) {
+            if (jsonField(record, "benchmark") != m.benchmark ||
+                jsonField(record, "distribution") != m.distribution ||
+                (size_t)atoll(jsonField(record, "n").c_str()) != m.n) {
+                continue;
+            }
+            double before = atof(jsonField(record, "ns_per_op").c_str());
+            double change = before > 0 ? (m.nsPerOp - before) * 100.0 / before : 0;
+            if (change > options.threshold) {
+                cout << "REGRESSION " << m.benchmark << "/" << m.distribution << "/" << m.n << ": "
+                     << before << " -> " << m.nsPerOp << " ns/op (+" << change << "%)" << endl;
+                regressions++;
+            }
+        }
+    }
+    if (regressions == 0) cout << "No regressions above " << options.threshold << "%" << endl;
+    return regressions;
+}
+
+// Runs every benchmark over sizes minN..maxN (powers of ten) and every
+// distribution it supports. Returns a non-zero exit code on regressions.
+inline int runBenchmarks(const vector<Benchmark>& benchmarks, int argc, char** argv,
+                         const CounterReader& counters = CounterReader()) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) return 2;
+
+    vector<Measurement> results;
+    cout << "Benchmark\t\tDist\t\tN\tns/op\t\tops/s\t\tRSS(KB)\tAllocs" << endl;
+    cout << "------------------------------------------------------------------------------------------" << endl;
+    for (const auto& bench : benchmarks) {
+        if (!options.filter.empty() && bench.name.find(options.filter) == string::npos) continue;
+        for (Distribution d : bench.distributions) {
+            size_t limit = min(options.maxN, bench.maxN(d));
+            for (size_t n = options.minN; n <= limit; n *= 10) {
+                Measurement m = runOne(bench, n, d, options, counters);
+                results.push_back(m);
+                cout << m.benchmark << (m.benchmark.size() < 16 ? "\t\t" : "\t") << m.distribution
+                     << (m.distribution.size() < 8 ? "\t\t" : "\t") << m.n << "\t" << m.nsPerOp
+                     << "\t\t" << m.opsPerSec << "\t" << m.peakRssKb << "\t" << m.allocations;
+                for (const auto& metric : m.metrics) cout << "\t" << metric.first << "=" << metric.second;
+                cout << endl;
+                if (n > limit / 10) break;     // The next step would pass limit or wrap
+            }
+        }
+    }
+
+    if (!options.jsonPath.empty()) {
+        ofstream out(options.jsonPath);
+        out << "{\"label\":\"" << jsonEscape(options.label) << "\",\"results\":[\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            out << jsonRecord(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+        cout << "\nWrote " << results.size() << " results to " << options.jsonPath << endl;
+    }
+
+    if (!options.baselinePath.empty() && compareWithBaseline(results, options) > 0) {
+        return 1;
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,180 @@
+// Multi-threaded throughput and latency benchmark for the concurrent
+// containers in containers.h
+//
+//   g++ -std=c++17 -O2 -pthread -o concurrency_benchmark concurrency_benchmark.c++
+//   ./concurrency_benchmark --max 1e6 --filter mpmc
+//
+// N is the number of items passed through the container. Each benchmark
+// runs 1..64 threads, split evenly into producers and consumers (one thread
+// alternates between the two). Every SAMPLE_EVERY-th item carries its enqueue
+// timestamp, so consumers can report end-to-end latency percentiles.
+#include "containers.h"
+#include "benchmark.h"
+#include <mutex>
+#include <queue>
+
+const size_t CONCURRENT_LIMIT = 10000000;
+const size_t CONTAINER_CAPACITY = 1024;
+const size_t SAMPLE_EVERY = 16;
+static const vector<int> THREAD_COUNTS = {1, 2, 4, 8, 16, 32, 64};
+
+static const vector<Distribution> SINGLE_DISTRIBUTION = {Distribution::RANDOM};
+
+static function<size_t(Distribution)> upTo(size_t limit) {
+    return [limit](Distribution) { return limit; };
+}
+
+static int64_t nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Baseline for comparison: std::queue guarded by a mutex, bounded like the rest
+template<typename T>
+class MutexQueue {
+private:
+    mutex lock;
+    queue<T> items;
+    size_t limit;
+
+public:
+    explicit MutexQueue(size_t capacity) : limit(capacity) {}
+
+    bool tryEnqueue(T element) {
+        lock_guard<mutex> guard(lock);
+        if (items.size() == limit) return false;
+        items.push(move(element));
+        return true;
+    }
+
+    bool tryDequeue(T& element) {
+        lock_guard<mutex> guard(lock);
+        if (items.empty()) return false;
+        element = move(items.front());
+        items.pop();
+        return true;
+    }
+};
+
+// Uniform put/take over the different container interfaces
+template<typename Q>
+static bool put(Q& container, int64_t value) {
+    return container.tryEnqueue(value);
+}
+
+template<typename Q>
+static bool take(Q& container, int64_t& value) {
+    return container.tryDequeue(value);
+}
+
+static bool put(ConcurrentStack<int64_t>& stack, int64_t value) {
+    return stack.tryPush(value);
+}
+
+static bool take(ConcurrentStack<int64_t>& stack, int64_t& value) {
+    return stack.tryPop(value);
+}
+
+static void reportLatency(BenchState& state, vector<vector<int64_t>>& perThread) {
+    vector<int64_t> samples;
+    for (auto& thread : perThread) samples.insert(samples.end(), thread.begin(), thread.end());
+    if (samples.empty()) return;
+    sort(samples.begin(), samples.end());
+    auto at = [&](double fraction) {
+        return (double)samples[min(samples.size() - 1, (size_t)(fraction * samples.size()))];
+    };
+    state.report("p50_ns", at(0.50));
+    state.report("p99_ns", at(0.99));
+    state.report("p999_ns", at(0.999));
+    state.report("max_ns", (double)samples.back());
+}
+
+// Value for the i-th item a producer sends: a timestamp when sampled, else -1
+static int64_t stamp(size_t i) {
+    return i % SAMPLE_EVERY == 0 ? nowNs() : -1;
+}
+
+static void record(vector<int64_t>& latencies, int64_t value) {
+    if (value >= 0) latencies.push_back(nowNs() - value);
+}
+
+template<typename Q>
+static void transfer(BenchState& state, int threads) {
+    Q container(CONTAINER_CAPACITY);
+    size_t n = state.n;
+    int producers = max(1, threads / 2);
+    int consumers = max(1, threads - producers);
+    vector<vector<int64_t>> latencies(max(threads, 1));
+    atomic<bool> go(false);
+    vector<thread> workers;
+
+    // Share of n for worker i out of count, remainder spread over the first few
+    auto share = [n](int i, int count) {
+        return n / count + ((size_t)i < n % count ? 1 : 0);
+    };
+
+    if (threads == 1) {
+        workers.emplace_back([&]() {
+            while (!go.load(memory_order_acquire)) this_thread::yield();
+            int64_t value = -1;
+            for (size_t i = 0; i < n; i++) {
+                put(container, stamp(i));
+                take(container, value);
+                record(latencies[0], value);
+            }
+        });
+    } else {
+        for (int p = 0; p < producers; p++) {
+            workers.emplace_back([&, p]() {
+                while (!go.load(memory_order_acquire)) this_thread::yield();
+                size_t items = share(p, producers);
+                for (size_t i = 0; i < items; i++) {
+                    int64_t value = stamp(i);
+                    while (!put(container, value)) this_thread::yield();
+                }
+            });
+        }
+        for (int c = 0; c < consumers; c++) {
+            workers.emplace_back([&, c]() {
+                vector<int64_t>& mine = latencies[producers + c];
+                size_t items = share(c, consumers);
+                mine.reserve(items / SAMPLE_EVERY + 1);
+                while (!go.load(memory_order_acquire)) this_thread::yield();
+                int64_t value = -1;
+                for (size_t i = 0; i < items; i++) {
+                    while (!take(container, value)) this_thread::yield();
+                    record(mine, value);
+                }
+            });
+        }
+    }
+
+    state.time([&]() {
+        go.store(true, memory_order_release);
+        for (auto& worker : workers) worker.join();
+    });
+    state.ops = n;
+    reportLatency(state, latencies);
+}
+
+template<typename Q>
+static void addThreadSweep(vector<Benchmark>& benchmarks, const string& name, const vector<int>& threadCounts) {
+    for (int threads : threadCounts) {
+        benchmarks.push_back({name + "_t" + to_string(threads), SINGLE_DISTRIBUTION, upTo(CONCURRENT_LIMIT),
+            [threads](BenchState& state) { transfer<Q>(state, threads); }});
+    }
+}
+
+static vector<Benchmark> concurrencyBenchmarks() {
+    vector<Benchmark> benchmarks;
+    // SPSC is only correct with exactly one producer and one consumer
+    addThreadSweep<SpscQueue<int64_t>>(benchmarks, "spsc_queue", {1, 2});
+    addThreadSweep<MpmcQueue<int64_t>>(benchmarks, "mpmc_queue", THREAD_COUNTS);
+    addThreadSweep<ConcurrentStack<int64_t>>(benchmarks, "concurrent_stack", THREAD_COUNTS);
+    addThreadSweep<MutexQueue<int64_t>>(benchmarks, "mutex_queue", THREAD_COUNTS);
+    return benchmarks;
+}
+
+int main(int argc, char** argv) {
+    return runBenchmarks(concurrencyBenchmarks(), argc, argv);
+}
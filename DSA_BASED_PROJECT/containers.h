@@ -0,0 +1,461 @@
+#ifndef DSA_CONTAINERS_H
+#define DSA_CONTAINERS_H
+
+// Queue and stack containers shared by dsa_library.c++ and scheduling_alog.c++.
+//
+//   RingBuffer<T>       growable circular buffer, amortized O(1) at both ends
+//   Queue<T>, Stack<T>  single-threaded FIFO/LIFO adapters over RingBuffer
+//   SpscQueue<T>        bounded lock-free queue, one producer + one consumer
+//   MpmcQueue<T>        bounded lock-free queue, any number of threads
+//   ConcurrentStack<T>  bounded lock-free Treiber stack, any number of threads
+//
+// Nothing here prints: an empty pop or a full bounded container is reported
+// by returning false.
+
+#include <iostream>
+#include <memory>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+using namespace std;
+
+static const size_t CACHE_LINE_SIZE = 64;
+
+// Smallest power of two >= n (and >= 2)
+inline size_t roundUpToPowerOfTwo(size_t n) {
+    size_t capacity = 2;
+    while (capacity < n) capacity <<= 1;
+    return capacity;
+}
+
+// Spin-then-yield backoff for failed compare-and-swap loops
+class Backoff {
+private:
+    int spins;
+
+public:
+    Backoff() : spins(1) {}
+
+    void pause() {
+        if (spins <= 64) {
+            for (int i = 0; i < spins; i++) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
+            }
+            spins <<= 1;
+        } else {
+            this_thread::yield();
+        }
+    }
+};
+
+// ==================== RING BUFFER ====================
+// Power-of-two circular buffer over raw storage: elements are constructed on
+// push and destroyed on pop, so T only needs to be movable. When full, the
+// buffer doubles and moves the elements across in order.
+template<typename T>
+class RingBuffer {
+private:
+    T* slots;
+    size_t mask;     // capacity - 1
+    size_t head;     // Physical index of the front element
+    size_t count;
+    allocator<T> alloc;
+
+    T* slot(size_t logical) const {
+        return slots + ((head + logical) & mask);
+    }
+
+    void grow() {
+        size_t capacity = (mask + 1) * 2;
+        T* larger = alloc.allocate(capacity);
+        for (size_t i = 0; i < count; i++) {
+            T* from = slot(i);
+            new (larger + i) T(move(*from));
+            from->~T();
+        }
+        alloc.deallocate(slots, mask + 1);
+        slots = larger;
+        mask = capacity - 1;
+        head = 0;
+    }
+
+public:
+    explicit RingBuffer(size_t initialCapacity = 16)
+        : mask(roundUpToPowerOfTwo(initialCapacity) - 1), head(0), count(0) {
+        slots = alloc.allocate(mask + 1);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    ~RingBuffer() {
+        clear();
+        alloc.deallocate(slots, mask + 1);
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    void pushBack(T value) {
+        if (count == mask + 1) grow();
+        new (slot(count)) T(move(value));
+        count++;
+    }
+
+    void pushFront(T value) {
+        if (count == mask + 1) grow();
+        head = (head - 1) & mask;
+        new (slots + head) T(move(value));
+        count++;
+    }
+
+    bool popFront(T& out) {
+        if (count == 0) return false;
+        T* front = slots + head;
+        out = move(*front);
+        front->~T();
+        head = (head + 1) & mask;
+        count--;
+        return true;
+    }
+
+    bool popBack(T& out) {
+        if (count == 0) return false;
+        T* back = slot(count - 1);
+        out = move(*back);
+        back->~T();
+        count--;
+        return true;
+    }
+
+    // i-th element from the front; i must be < size()
+    T& operator[](size_t i) {
+        return *slot(i);
+    }
+
+    const T& operator[](size_t i) const {
+        return *slot(i);
+    }
+
+    void clear() {
+        for (size_t i = 0; i < count; i++) slot(i)->~T();
+        head = count = 0;
+    }
+};
+
+// ==================== QUEUE ====================
+template<typename T>
+class Queue {
+private:
+    RingBuffer<T> buffer;
+
+public:
+    explicit Queue(size_t initialCapacity = 16) : buffer(initialCapacity) {}
+
+    void enqueue(T element) {
+        buffer.pushBack(move(element));
+    }
+
+    // Returns false if the queue is empty
+    bool dequeue(T& element) {
+        return buffer.popFront(element);
+    }
+
+    bool peek(T& element) const {
+        if (buffer.isEmpty()) return false;
+        element = buffer[0];
+        return true;
+    }
+
+    bool isEmpty() const {
+        return buffer.isEmpty();
+    }
+
+    int getSize() const {
+        return buffer.size();
+    }
+
+    void display() const {
+        cout << "Queue: ";
+        for (size_t i = 0; i < buffer.size(); i++) {
+            cout << buffer[i] << " ";
+        }
+        cout << endl;
+    }
+};
+
+// ==================== STACK ====================
+template<typename T>
+class Stack {
+private:
+    RingBuffer<T> buffer;
+
+public:
+    explicit Stack(size_t initialCapacity = 16) : buffer(initialCapacity) {}
+
+    void push(T element) {
+        buffer.pushBack(move(element));
+    }
+
+    // Returns false if the stack is empty
+    bool pop(T& element) {
+        return buffer.popBack(element);
+    }
+
+    bool peek(T& element) const {
+        if (buffer.isEmpty()) return false;
+        element = buffer[buffer.size() - 1];
+        return true;
+    }
+
+    bool isEmpty() const {
+        return buffer.isEmpty();
+    }
+
+    int getSize() const {
+        return buffer.size();
+    }
+
+    void display() const {
+        cout << "Stack (top to bottom): ";
+        for (size_t i = buffer.size(); i > 0; i--) {
+            cout << buffer[i - 1] << " ";
+        }
+        cout << endl;
+    }
+};
+
+// ==================== SPSC QUEUE ====================
+// Bounded queue for exactly one producer thread and one consumer thread.
+// Each side owns one index and keeps a cached copy of the other, so the
+// shared cache line is only read when the cached view says full or empty.
+template<typename T>
+class SpscQueue {
+private:
+    unique_ptr<T[]> slots;
+    size_t mask;
+
+    alignas(CACHE_LINE_SIZE) atomic<size_t> head;   // Next slot to read
+    size_t cachedTail;                              // Consumer's view of tail
+    alignas(CACHE_LINE_SIZE) atomic<size_t> tail;   // Next slot to write
+    size_t cachedHead;                              // Producer's view of head
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity)
+        : slots(new T[roundUpToPowerOfTwo(capacity)]), mask(roundUpToPowerOfTwo(capacity) - 1),
+          head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    // Producer only. Returns false if the queue is full.
+    bool tryEnqueue(T element) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(memory_order_acquire);
+            if (t - cachedHead > mask) return false;
+        }
+        slots[t & mask] = move(element);
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool tryDequeue(T& element) {
+        size_t h = head.load(memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        element = move(slots[h & mask]);
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // Exact only when neither side is running
+    size_t sizeApprox() const {
+        return tail.load(memory_order_acquire) - head.load(memory_order_acquire);
+    }
+};
+
+// ==================== MPMC QUEUE ====================
+// Bounded multi-producer multi-consumer queue (Vyukov's design). Every cell
+// carries a sequence number telling whose turn it is: a producer at position
+// p waits for sequence == p, a consumer for p + 1. Threads claim positions
+// with one CAS and never touch a lock.
+template<typename T>
+class MpmcQueue {
+private:
+    struct Cell {
+        atomic<size_t> sequence;
+        T data;
+    };
+
+    unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(CACHE_LINE_SIZE) atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE_SIZE) atomic<size_t> dequeuePos;
+
+public:
+    // Capacity is rounded up to a power of two
+    explicit MpmcQueue(size_t capacity)
+        : cells(new Cell[roundUpToPowerOfTwo(capacity)]), mask(roundUpToPowerOfTwo(capacity) - 1),
+          enqueuePos(0), dequeuePos(0) {
+        for (size_t i = 0; i <= mask; i++) {
+            cells[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    // Returns false if the queue is full
+    bool tryEnqueue(T element) {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->data = move(element);
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    // Returns false if the queue is empty
+    bool tryDequeue(T& element) {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        element = move(cell->data);
+        cell->sequence.store(pos + mask + 1, memory_order_release);
+        return true;
+    }
+};
+
+// ==================== CONCURRENT STACK ====================
+// Bounded lock-free Treiber stack. Nodes come from a fixed array and are
+// linked by index; both the stack and its free list are heads packing
+// (tag << 32 | index) into one word. Every successful CAS bumps the tag, so a
+// node that was popped and pushed back in between cannot fool a stale CAS
+// (the ABA problem), and nodes are never freed while threads may read them.
+template<typename T>
+class ConcurrentStack {
+private:
+    static const uint32_t NIL = UINT32_MAX;
+
+    struct Node {
+        T value;
+        atomic<uint32_t> next;
+    };
+
+    unique_ptr<Node[]> nodes;
+    size_t nodeCount;
+    alignas(CACHE_LINE_SIZE) atomic<uint64_t> top;
+    alignas(CACHE_LINE_SIZE) atomic<uint64_t> freeList;
+
+    static uint64_t pack(uint64_t tag, uint32_t index) {
+        return (tag << 32) | index;
+    }
+
+    uint32_t popFrom(atomic<uint64_t>& list) {
+        Backoff backoff;
+        uint64_t head = list.load(memory_order_acquire);
+        while (true) {
+            uint32_t index = (uint32_t)head;
+            if (index == NIL) return NIL;
+            uint32_t next = nodes[index].next.load(memory_order_relaxed);
+            if (list.compare_exchange_weak(head, pack((head >> 32) + 1, next),
+                                           memory_order_acq_rel, memory_order_acquire)) {
+                return index;
+            }
+            backoff.pause();
+        }
+    }
+
+    void pushTo(atomic<uint64_t>& list, uint32_t index) {
+        Backoff backoff;
+        uint64_t head = list.load(memory_order_relaxed);
+        while (true) {
+            nodes[index].next.store((uint32_t)head, memory_order_relaxed);
+            if (list.compare_exchange_weak(head, pack((head >> 32) + 1, index),
+                                           memory_order_release, memory_order_relaxed)) {
+                return;
+            }
+            backoff.pause();
+        }
+    }
+
+public:
+    explicit ConcurrentStack(size_t capacity)
+        : nodes(new Node[capacity]), nodeCount(capacity), top(pack(0, NIL)), freeList(pack(0, NIL)) {
+        for (size_t i = 0; i < capacity; i++) {
+            nodes[i].next.store(i + 1 < capacity ? i + 1 : NIL, memory_order_relaxed);
+        }
+        if (capacity > 0) freeList.store(pack(0, 0), memory_order_relaxed);
+    }
+
+    size_t capacity() const {
+        return nodeCount;
+    }
+
+    // Returns false if all nodes are in use
+    bool tryPush(T element) {
+        uint32_t index = popFrom(freeList);
+        if (index == NIL) return false;
+        nodes[index].value = move(element);
+        pushTo(top, index);
+        return true;
+    }
+
+    // Returns false if the stack is empty
+    bool tryPop(T& element) {
+        uint32_t index = popFrom(top);
+        if (index == NIL) return false;
+        element = move(nodes[index].value);
+        pushTo(freeList, index);
+        return true;
+    }
+
+    bool isEmpty() const {
+        return (uint32_t)top.load(memory_order_acquire) == NIL;
+    }
+};
+
+#endif
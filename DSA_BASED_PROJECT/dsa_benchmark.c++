@@ -0,0 +1,453 @@
+// Benchmark driver for dsa_library.c++
+//
+//   g++ -std=c++17 -O2 -pthread -o dsa_benchmark dsa_benchmark.c++
+//   ./dsa_benchmark --max 1e6 --json dsa.json
+//
+// Add -DDSA_COUNTERS to also report comparisons, node allocations and
+// pointer hops per run.
+#define DSA_LIBRARY_NO_MAIN
+#include "dsa_library.c++"
+#include "benchmark.h"
+
+// Sizes above which the O(n^2) (or degenerate-input) operations take too long
+const size_t QUADRATIC_LIMIT = 100000;
+const size_t LINEAR_LIMIT = 100000000;
+
+static const vector<Distribution> KEY_DISTRIBUTIONS = {
+    Distribution::RANDOM, Distribution::SORTED, Distribution::REVERSE_SORTED, Distribution::DUPLICATE_HEAVY
+};
+static const vector<Distribution> GRAPH_DISTRIBUTIONS = {
+    Distribution::RANDOM, Distribution::SKEWED
+};
+
+static function<size_t(Distribution)> upTo(size_t limit) {
+    return [limit](Distribution) { return limit; };
+}
+
+// Searches are O(n) each, so only a bounded sample of lookups is timed
+static size_t lookupCount(size_t n) {
+    return min<size_t>(n, 1000);
+}
+
+// Edge list with ~8 edges per vertex. SKEWED draws one endpoint from a cubic
+// distribution so a few low-numbered hubs collect most of the edges.
+static vector<pair<int, int>> generateEdges(size_t vertices, Distribution d) {
+    mt19937 rng(7);
+    vector<pair<int, int>> edges;
+    size_t edgeCount = vertices * 4;
+    edges.reserve(edgeCount + vertices);
+    // Spanning path keeps the graph connected so traversals visit everything
+    for (size_t v = 1; v < vertices; v++) {
+        edges.push_back({(int)(v - 1), (int)v});
+    }
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    for (size_t e = 0; e < edgeCount; e++) {
+        int src = rng() % vertices;
+        int dest;
+        if (d == Distribution::SKEWED) {
+            double u = unit(rng);
+            dest = (int)(u * u * u * vertices);
+        } else {
+            dest = rng() % vertices;
+        }
+        edges.push_back({src, dest});
+    }
+    return edges;
+}
+
+static vector<Benchmark> dsaBenchmarks() {
+    vector<Benchmark> benchmarks;
+    benchmarks.push_back({"array_insert", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            Array arr(state.n);
+            state.time([&]() {
+                for (int key : keys) arr.insert(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"array_search", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            Array arr(state.n);
+            for (int key : keys) arr.insert(key);
+            size_t lookups = lookupCount(state.n);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < lookups; i++) found += arr.search(keys[(i * 7919) % state.n]);
+            });
+            state.ops = lookups;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"array_bubble_sort", KEY_DISTRIBUTIONS, upTo(QUADRATIC_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            Array arr(state.n);
+            for (int key : keys) arr.insert(key);
+            state.time([&]() {
+                arr.bubbleSort();
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"list_insert_front", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            LinkedList<int> list;
+            state.time([&]() {
+                for (int key : keys) list.insertFront(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"list_insert_end", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            LinkedList<int> list;
+            state.time([&]() {
+                for (int key : keys) list.insertEnd(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"list_search", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            LinkedList<int> list;
+            for (int key : keys) list.insertFront(key);
+            size_t lookups = lookupCount(state.n);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < lookups; i++) found += list.search(keys[(i * 7919) % state.n]);
+            });
+            state.ops = lookups;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"list_reverse", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            LinkedList<int> list;
+            for (int key : keys) list.insertFront(key);
+            state.time([&]() {
+                list.reverse();
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"unrolled_insert_end", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            UnrolledLinkedList<int> list;
+            state.time([&]() {
+                for (int key : keys) list.insertEnd(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"unrolled_search", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            UnrolledLinkedList<int> list;
+            for (int key : keys) list.insertFront(key);
+            size_t lookups = lookupCount(state.n);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < lookups; i++) found += list.search(keys[(i * 7919) % state.n]);
+            });
+            state.ops = lookups;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"unrolled_reverse", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            UnrolledLinkedList<int> list;
+            for (int key : keys) list.insertFront(key);
+            state.time([&]() {
+                list.reverse();
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"stack_push_pop", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            Stack<int> stack;
+            long long sum = 0;
+            state.time([&]() {
+                for (int key : keys) stack.push(key);
+                int top;
+                while (stack.pop(top)) sum += top;
+            });
+            state.ops = 2 * state.n;
+            consume(sum);
+        }});
+
+    benchmarks.push_back({"queue_enqueue_dequeue", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            Queue<int> queue;
+            long long sum = 0;
+            state.time([&]() {
+                for (int key : keys) queue.enqueue(key);
+                int front;
+                while (queue.dequeue(front)) sum += front;
+            });
+            state.ops = 2 * state.n;
+            consume(sum);
+        }});
+
+    // Sorted input degenerates the unbalanced BST into a list (and deep recursion)
+    auto bstLimit = [](Distribution d) {
+        return (d == Distribution::SORTED || d == Distribution::REVERSE_SORTED) ? QUADRATIC_LIMIT / 10
+                                                                                : LINEAR_LIMIT;
+    };
+
+    benchmarks.push_back({"bst_insert", KEY_DISTRIBUTIONS, bstLimit,
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BST bst;
+            state.time([&]() {
+                for (int key : keys) bst.insert(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"bst_find", KEY_DISTRIBUTIONS, bstLimit,
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BST bst;
+            for (int key : keys) bst.insert(key);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < state.n; i++) found += bst.find(keys[(i * 7919) % state.n]);
+            });
+            state.ops = state.n;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"btree_insert", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BTreeSet set;
+            state.time([&]() {
+                for (int key : keys) set.insert(key);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"btree_find", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BTreeSet set;
+            for (int key : keys) set.insert(key);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < state.n; i++) found += set.find(keys[(i * 7919) % state.n]);
+            });
+            state.ops = state.n;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"btree_remove", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BTreeSet set;
+            for (int key : keys) set.insert(key);
+            state.time([&]() {
+                for (int key : keys) set.remove(key);
+            });
+            state.ops = state.n;
+        }});
+
+    // Ten short scans of up to 100 keys from random starting points per op
+    benchmarks.push_back({"btree_range_scan", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            BTreeSet set;
+            for (int key : keys) set.insert(key);
+            long long sum = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < state.n; i += 10) {
+                    BTreeSet::Iterator it = set.lowerBound(keys[(i * 7919) % state.n]);
+                    for (int step = 0; step < 100 && it.hasNext(); step++) sum += it.next();
+                }
+            });
+            state.ops = state.n;
+            consume(sum);
+        }});
+
+    benchmarks.push_back({"eytzinger_find", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            EytzingerIndex index(keys);
+            long long found = 0;
+            state.time([&]() {
+                for (size_t i = 0; i < state.n; i++) found += index.find(keys[(i * 7919) % state.n]);
+            });
+            state.ops = state.n;
+            consume(found);
+        }});
+
+    benchmarks.push_back({"graph_build", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<pair<int, int>> edges = generateEdges(state.n, state.distribution);
+            state.time([&]() {
+                Graph graph(state.n);
+                for (const auto& e : edges) graph.addEdge(e.first, e.second);
+            });
+            state.ops = edges.size();
+        }});
+
+    benchmarks.push_back({"graph_bfs", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<pair<int, int>> edges = generateEdges(state.n, state.distribution);
+            Graph graph(state.n);
+            for (const auto& e : edges) graph.addEdge(e.first, e.second);
+            state.time([&]() {
+                graph.bfs(0);
+            });
+            state.ops = state.n + 2 * edges.size();
+        }});
+
+    benchmarks.push_back({"graph_dfs", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<pair<int, int>> edges = generateEdges(state.n, state.distribution);
+            Graph graph(state.n);
+            for (const auto& e : edges) graph.addEdge(e.first, e.second);
+            state.time([&]() {
+                graph.dfs(0);
+            });
+            state.ops = state.n + 2 * edges.size();
+        }});
+
+    benchmarks.push_back({"csr_freeze", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            vector<pair<int, int>> edges = generateEdges(state.n, state.distribution);
+            Graph graph(state.n);
+            for (const auto& e : edges) graph.addEdge(e.first, e.second);
+            uint64_t stored = 0;
+            state.time([&]() {
+                stored = graph.freeze().edgeCount();
+            });
+            state.ops = stored;
+        }});
+
+    benchmarks.push_back({"csr_bfs", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            CSRGraph graph = CSRGraph::fromEdges(state.n, generateEdges(state.n, state.distribution));
+            long long sum = 0;
+            state.time([&]() {
+                graph.bfs(0, [&](int v) { sum += v; });
+            });
+            state.ops = state.n + graph.edgeCount();
+            consume(sum);
+        }});
+
+    benchmarks.push_back({"csr_dfs", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            CSRGraph graph = CSRGraph::fromEdges(state.n, generateEdges(state.n, state.distribution));
+            long long sum = 0;
+            state.time([&]() {
+                graph.dfs(0, [&](int v) { sum += v; });
+            });
+            state.ops = state.n + graph.edgeCount();
+            consume(sum);
+        }});
+
+    benchmarks.push_back({"csr_parallel_bfs", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            CSRGraph graph = CSRGraph::fromEdges(state.n, generateEdges(state.n, state.distribution));
+            vector<int> depth;
+            state.time([&]() {
+                depth = graph.parallelBfs(0);
+            });
+            state.ops = state.n + graph.edgeCount();
+            consume(depth.back());
+        }});
+
+    // Save is untimed; load maps the file and touches every page of it
+    benchmarks.push_back({"csr_load", GRAPH_DISTRIBUTIONS, upTo(LINEAR_LIMIT / 10),
+        [](BenchState& state) {
+            const string path = "dsa_benchmark.csr";
+            uint64_t edgeCount;
+            {
+                CSRGraph graph = CSRGraph::fromEdges(state.n, generateEdges(state.n, state.distribution));
+                graph.save(path);
+                edgeCount = graph.edgeCount();
+            }
+            long long sum = 0;
+            state.time([&]() {
+                CSRGraph graph = CSRGraph::load(path);
+                for (int v = 0; v < graph.vertexCount(); v += 512) sum += graph.degree(v);
+            });
+            state.ops = edgeCount;
+            consume(sum);
+            remove(path.c_str());
+        }});
+
+    benchmarks.push_back({"merge_sort", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            state.time([&]() {
+                Sorting::mergeSort(keys, 0, keys.size() - 1);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"quick_sort", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            state.time([&]() {
+                Sorting::quickSort(keys);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"radix_sort", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            state.time([&]() {
+                Sorting::radixSort(keys);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"parallel_merge_sort", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            state.time([&]() {
+                Sorting::parallelMergeSort(keys);
+            });
+            state.ops = state.n;
+        }});
+
+    benchmarks.push_back({"auto_sort_desc", KEY_DISTRIBUTIONS, upTo(LINEAR_LIMIT),
+        [](BenchState& state) {
+            vector<int> keys = generateKeys(state.n, state.distribution);
+            state.time([&]() {
+                Sorting::sort(keys, greater<int>());
+            });
+            state.ops = state.n;
+        }});
+
+    return benchmarks;
+}
+
+int main(int argc, char** argv) {
+    CounterReader counters;
+#ifdef DSA_COUNTERS
+    counters = []() {
+        OpCounters totals = opCounterTotals();
+        return vector<pair<string, uint64_t>>{
+            {"comparisons", totals.comparisons},
+            {"node_allocations", totals.nodeAllocations},
+            {"pointer_hops", totals.pointerHops}
+        };
+    };
+#endif
+    return runBenchmarks(dsaBenchmarks(), argc, argv, counters);
+}
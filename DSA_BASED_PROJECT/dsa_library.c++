@@ -1,8 +1,70 @@
 #include <iostream>
 #include <vector>
 #include <climits>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "containers.h"   // Stack, Queue and their lock-free variants
 using namespace std;
 
+// ==================== HOT-PATH COUNTERS ====================
+// Build with -DDSA_COUNTERS to count comparisons, node allocations and pointer
+// hops inside the data structures. Without it DSA_COUNT() compiles to nothing.
+// Each thread counts into its own copy, so parallel sorts and BFS do not race;
+// a worker's counts are folded into the shared totals when it exits, which
+// happens before join() returns. Read them with opCounterTotals().
+#ifdef DSA_COUNTERS
+struct OpCounters {
+    unsigned long long comparisons = 0;
+    unsigned long long nodeAllocations = 0;
+    unsigned long long pointerHops = 0;
+
+    void add(const OpCounters& other) {
+        comparisons += other.comparisons;
+        nodeAllocations += other.nodeAllocations;
+        pointerHops += other.pointerHops;
+    }
+};
+
+OpCounters exitedOpCounters;
+mutex exitedOpCountersLock;
+
+struct ThreadOpCounters : OpCounters {
+    ~ThreadOpCounters() {
+        lock_guard<mutex> guard(exitedOpCountersLock);
+        exitedOpCounters.add(*this);
+    }
+};
+
+thread_local ThreadOpCounters opCounters;
+
+// Counts of every finished thread plus the calling thread's own
+OpCounters opCounterTotals() {
+    lock_guard<mutex> guard(exitedOpCountersLock);
+    OpCounters totals = exitedOpCounters;
+    totals.add(opCounters);
+    return totals;
+}
+
+#define DSA_COUNT(counter) (opCounters.counter++)
+#else
+#define DSA_COUNT(counter) ((void)0)
+#endif
+
 // ==================== ARRAY OPERATIONS ====================
 class Array {
 private:
@@ -11,7 +73,7 @@ private:
     int capacity;
 
 public:
-    Array(int cap) : capacity(cap), size(0) {
+    Array(int cap) : size(0), capacity(cap) {
         arr = new int[capacity];
     }
 
@@ -38,6 +100,7 @@ public:
 
     int search(int element) {
         for (int i = 0; i < size; i++) {
+            DSA_COUNT(comparisons);
             if (arr[i] == element) return i;
         }
         return -1;
@@ -54,6 +117,7 @@ public:
     void bubbleSort() {
         for (int i = 0; i < size - 1; i++) {
             for (int j = 0; j < size - i - 1; j++) {
+                DSA_COUNT(comparisons);
                 if (arr[j] > arr[j + 1]) {
                     swap(arr[j], arr[j + 1]);
                 }
@@ -62,84 +126,237 @@ public:
     }
 };
 
-// ==================== LINKED LIST ====================
-struct ListNode {
-    int data;
-    ListNode* next;
-    ListNode(int val) : data(val), next(nullptr) {}
+// ==================== NODE POOL ====================
+// Slab allocator for fixed-size list nodes. Slabs grow geometrically and are
+// only returned to the heap when the pool dies; freed nodes go onto an
+// intrusive free list, so steady-state inserts and deletes never call new.
+template<typename Node>
+class NodePool {
+private:
+    static constexpr size_t FIRST_SLAB = 8;
+    static constexpr size_t MAX_SLAB = 4096;
+
+    struct Slot {
+        alignas(Node) unsigned char bytes[sizeof(Node)];
+    };
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+    static_assert(sizeof(Node) >= sizeof(FreeSlot), "node too small to hold a free-list link");
+
+    vector<pair<Slot*, size_t>> slabs;
+    FreeSlot* freeList;
+    size_t nextSlabSize;
+    allocator<Slot> alloc;
+
+    void refill() {
+        Slot* slab = alloc.allocate(nextSlabSize);
+        slabs.push_back({slab, nextSlabSize});
+        // Thread the free list in address order so consecutive inserts land
+        // in consecutive slots
+        for (size_t i = nextSlabSize; i > 0; i--) {
+            freeList = new (&slab[i - 1]) FreeSlot{freeList};
+        }
+        nextSlabSize = min(nextSlabSize * 2, MAX_SLAB);
+    }
+
+public:
+    NodePool() : freeList(nullptr), nextSlabSize(FIRST_SLAB) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept : NodePool() {
+        swap(other);
+    }
+
+    NodePool& operator=(NodePool&& other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    // Releases the slabs; every node must already have been destroyed
+    ~NodePool() {
+        for (auto& slab : slabs) alloc.deallocate(slab.first, slab.second);
+    }
+
+    void swap(NodePool& other) noexcept {
+        slabs.swap(other.slabs);
+        std::swap(freeList, other.freeList);
+        std::swap(nextSlabSize, other.nextSlabSize);
+    }
+
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        DSA_COUNT(nodeAllocations);
+        if (!freeList) refill();
+        void* slot = freeList;
+        freeList = freeList->next;
+        return new (slot) Node{forward<Args>(args)...};
+    }
+
+    void destroy(Node* node) {
+        node->~Node();
+        freeList = new (node) FreeSlot{freeList};
+    }
 };
 
+// ==================== LINKED LIST ====================
+// Singly linked list with head/tail pointers and a size, so both ends are
+// O(1). Nodes come from a per-list NodePool. T may be move-only.
+template<typename T>
 class LinkedList {
 private:
+    struct ListNode {
+        T data;
+        ListNode* next;
+    };
+
+    NodePool<ListNode> pool;
     ListNode* head;
+    ListNode* tail;
+    size_t count;
+
+    template<bool Const>
+    class Iter {
+    private:
+        ListNode* node;
+        friend class LinkedList;
+
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<Const, const T*, T*>::type pointer;
+        typedef typename conditional<Const, const T&, T&>::type reference;
+
+        explicit Iter(ListNode* start = nullptr) : node(start) {}
+
+        // iterator converts to const_iterator
+        operator Iter<true>() const {
+            return Iter<true>(node);
+        }
+
+        reference operator*() const {
+            return node->data;
+        }
+
+        pointer operator->() const {
+            return &node->data;
+        }
+
+        Iter& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter previous = *this;
+            node = node->next;
+            return previous;
+        }
+
+        bool operator==(const Iter& other) const {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iter& other) const {
+            return node != other.node;
+        }
+    };
 
 public:
-    LinkedList() : head(nullptr) {}
+    typedef Iter<false> iterator;
+    typedef Iter<true> const_iterator;
+
+    LinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    LinkedList(LinkedList&& other) noexcept
+        : pool(move(other.pool)), head(other.head), tail(other.tail), count(other.count) {
+        other.head = other.tail = nullptr;
+        other.count = 0;
+    }
+
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        clear();
+        pool.swap(other.pool);
+        swap(head, other.head);
+        swap(tail, other.tail);
+        swap(count, other.count);
+        return *this;
+    }
 
     ~LinkedList() {
-        while (head) {
-            ListNode* temp = head;
-            head = head->next;
-            delete temp;
-        }
+        clear();
     }
 
-    void insertFront(int data) {
-        ListNode* newNode = new ListNode(data);
-        newNode->next = head;
-        head = newNode;
+    size_t size() const {
+        return count;
     }
 
-    void insertEnd(int data) {
-        ListNode* newNode = new ListNode(data);
-        if (!head) {
-            head = newNode;
-            return;
-        }
-        ListNode* temp = head;
-        while (temp->next) {
-            temp = temp->next;
-        }
-        temp->next = newNode;
+    bool isEmpty() const {
+        return count == 0;
     }
 
-    void deleteNode(int data) {
-        if (!head) return;
-        
-        if (head->data == data) {
-            ListNode* temp = head;
-            head = head->next;
-            delete temp;
-            return;
-        }
+    void insertFront(T data) {
+        head = pool.create(move(data), head);
+        if (!tail) tail = head;
+        count++;
+    }
 
-        ListNode* temp = head;
-        while (temp->next && temp->next->data != data) {
-            temp = temp->next;
+    void insertEnd(T data) {
+        ListNode* newNode = pool.create(move(data), nullptr);
+        if (tail) {
+            tail->next = newNode;
+        } else {
+            head = newNode;
         }
-        
-        if (temp->next) {
-            ListNode* nodeToDelete = temp->next;
-            temp->next = temp->next->next;
-            delete nodeToDelete;
+        tail = newNode;
+        count++;
+    }
+
+    // Removes the first occurrence; returns false if data was not found
+    bool deleteNode(const T& data) {
+        ListNode* prev = nullptr;
+        ListNode* current = head;
+        while (current && !(current->data == data)) {
+            DSA_COUNT(comparisons);
+            DSA_COUNT(pointerHops);
+            prev = current;
+            current = current->next;
         }
+        if (!current) return false;
+        (prev ? prev->next : head) = current->next;
+        if (current == tail) tail = prev;
+        pool.destroy(current);
+        count--;
+        return true;
     }
 
-    bool search(int data) {
-        ListNode* temp = head;
-        while (temp) {
+    bool search(const T& data) const {
+        for (ListNode* temp = head; temp; temp = temp->next) {
+            DSA_COUNT(comparisons);
             if (temp->data == data) return true;
-            temp = temp->next;
+            DSA_COUNT(pointerHops);
         }
         return false;
     }
 
-    void display() {
+    // Nodes go back to the pool, which keeps its slabs for reuse
+    void clear() {
+        while (head) {
+            ListNode* next = head->next;
+            pool.destroy(head);
+            head = next;
+        }
+        tail = nullptr;
+        count = 0;
+    }
+
+    void display() const {
         cout << "Linked List: ";
-        ListNode* temp = head;
-        while (temp) {
+        for (ListNode* temp = head; temp; temp = temp->next) {
             cout << temp->data << " -> ";
-            temp = temp->next;
         }
         cout << "NULL" << endl;
     }
@@ -148,7 +365,8 @@ public:
         ListNode* prev = nullptr;
         ListNode* current = head;
         ListNode* next = nullptr;
-        
+        tail = head;
+
         while (current) {
             next = current->next;
             current->next = prev;
@@ -157,109 +375,264 @@ public:
         }
         head = prev;
     }
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(); }
 };
 
-// ==================== STACK ====================
-class Stack {
+// ==================== UNROLLED LINKED LIST ====================
+// Same interface as LinkedList, but each node packs several elements into
+// about one cache line, so a scan touches one pointer per block instead of
+// one per element. Deletes merge under-filled neighbours to keep nodes dense.
+template<typename T>
+class UnrolledLinkedList {
 private:
-    int* arr;
-    int top;
-    int capacity;
+    static constexpr size_t NODE_BYTES = 64;
+    static constexpr size_t HEADER_BYTES = sizeof(void*) + sizeof(uint32_t);
+    static constexpr size_t NODE_CAPACITY =
+        NODE_BYTES > HEADER_BYTES + 4 * sizeof(T) ? (NODE_BYTES - HEADER_BYTES) / sizeof(T) : 4;
 
-public:
-    Stack(int cap) : capacity(cap), top(-1) {
-        arr = new int[capacity];
+    struct Block {
+        Block* next;
+        uint32_t count;
+        alignas(T) unsigned char storage[NODE_CAPACITY * sizeof(T)];
+
+        Block() : next(nullptr), count(0) {}
+
+        T* items() {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        const T* items() const {
+            return reinterpret_cast<const T*>(storage);
+        }
+    };
+
+    NodePool<Block> pool;
+    Block* head;
+    Block* tail;
+    size_t count;
+
+    // Moves items [from, count) of a block one slot left, over a destroyed slot
+    static void closeGap(Block* block, uint32_t from) {
+        T* items = block->items();
+        for (uint32_t i = from; i + 1 < block->count; i++) {
+            new (&items[i]) T(move(items[i + 1]));
+            items[i + 1].~T();
+        }
+        block->count--;
     }
 
-    ~Stack() {
-        delete[] arr;
+    void destroyBlock(Block* block) {
+        T* items = block->items();
+        for (uint32_t i = 0; i < block->count; i++) items[i].~T();
+        pool.destroy(block);
     }
 
-    void push(int element) {
-        if (top < capacity - 1) {
-            arr[++top] = element;
-        } else {
-            cout << "Stack Overflow!" << endl;
+    template<bool Const>
+    class Iter {
+    private:
+        Block* block;
+        uint32_t index;
+
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<Const, const T*, T*>::type pointer;
+        typedef typename conditional<Const, const T&, T&>::type reference;
+
+        explicit Iter(Block* start = nullptr, uint32_t position = 0) : block(start), index(position) {}
+
+        operator Iter<true>() const {
+            return Iter<true>(block, index);
         }
-    }
 
-    int pop() {
-        if (top >= 0) {
-            return arr[top--];
+        reference operator*() const {
+            return block->items()[index];
         }
-        cout << "Stack Underflow!" << endl;
-        return -1;
-    }
 
-    int peek() {
-        if (top >= 0) {
-            return arr[top];
+        pointer operator->() const {
+            return &block->items()[index];
         }
-        cout << "Stack is empty!" << endl;
-        return -1;
+
+        Iter& operator++() {
+            if (++index == block->count) {
+                block = block->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iter& other) const {
+            return block == other.block && index == other.index;
+        }
+
+        bool operator!=(const Iter& other) const {
+            return !(*this == other);
+        }
+    };
+
+public:
+    typedef Iter<false> iterator;
+    typedef Iter<true> const_iterator;
+
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : pool(move(other.pool)), head(other.head), tail(other.tail), count(other.count) {
+        other.head = other.tail = nullptr;
+        other.count = 0;
     }
 
-    bool isEmpty() {
-        return top == -1;
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept {
+        clear();
+        pool.swap(other.pool);
+        swap(head, other.head);
+        swap(tail, other.tail);
+        swap(count, other.count);
+        return *this;
     }
 
-    void display() {
-        cout << "Stack (top to bottom): ";
-        for (int i = top; i >= 0; i--) {
-            cout << arr[i] << " ";
-        }
-        cout << endl;
+    ~UnrolledLinkedList() {
+        clear();
     }
-};
 
-// ==================== QUEUE ====================
-class Queue {
-private:
-    int* arr;
-    int front, rear;
-    int capacity;
+    static size_t blockCapacity() {
+        return NODE_CAPACITY;
+    }
 
-public:
-    Queue(int cap) : capacity(cap), front(0), rear(-1) {
-        arr = new int[capacity];
+    size_t size() const {
+        return count;
     }
 
-    ~Queue() {
-        delete[] arr;
+    bool isEmpty() const {
+        return count == 0;
     }
 
-    void enqueue(int element) {
-        if (rear < capacity - 1) {
-            arr[++rear] = element;
-        } else {
-            cout << "Queue Overflow!" << endl;
+    void insertFront(T data) {
+        if (!head || head->count == NODE_CAPACITY) {
+            Block* block = pool.create();
+            block->next = head;
+            head = block;
+            if (!tail) tail = block;
+        }
+        T* items = head->items();
+        for (uint32_t i = head->count; i > 0; i--) {
+            new (&items[i]) T(move(items[i - 1]));
+            items[i - 1].~T();
         }
+        new (&items[0]) T(move(data));
+        head->count++;
+        count++;
     }
 
-    int dequeue() {
-        if (front <= rear) {
-            int element = arr[front];
-            for (int i = 0; i < rear; i++) {
-                arr[i] = arr[i + 1];
+    void insertEnd(T data) {
+        if (!tail || tail->count == NODE_CAPACITY) {
+            Block* block = pool.create();
+            if (tail) {
+                tail->next = block;
+            } else {
+                head = block;
             }
-            rear--;
-            return element;
+            tail = block;
         }
-        cout << "Queue Underflow!" << endl;
-        return -1;
+        new (&tail->items()[tail->count]) T(move(data));
+        tail->count++;
+        count++;
     }
 
-    bool isEmpty() {
-        return front > rear;
+    // Removes the first occurrence; returns false if data was not found
+    bool deleteNode(const T& data) {
+        Block* prev = nullptr;
+        for (Block* block = head; block; prev = block, block = block->next) {
+            DSA_COUNT(pointerHops);
+            T* items = block->items();
+            for (uint32_t i = 0; i < block->count; i++) {
+                DSA_COUNT(comparisons);
+                if (!(items[i] == data)) continue;
+                items[i].~T();
+                closeGap(block, i);
+                count--;
+                if (block->count == 0) {
+                    (prev ? prev->next : head) = block->next;
+                    if (block == tail) tail = prev;
+                    pool.destroy(block);
+                } else if (block->next && block->count + block->next->count <= NODE_CAPACITY / 2) {
+                    // Both halves are sparse: pull the next block in
+                    Block* next = block->next;
+                    T* from = next->items();
+                    for (uint32_t j = 0; j < next->count; j++) {
+                        new (&items[block->count++]) T(move(from[j]));
+                    }
+                    block->next = next->next;
+                    if (next == tail) tail = block;
+                    destroyBlock(next);
+                }
+                return true;
+            }
+        }
+        return false;
     }
 
-    void display() {
-        cout << "Queue: ";
-        for (int i = front; i <= rear; i++) {
-            cout << arr[i] << " ";
+    bool search(const T& data) const {
+        for (Block* block = head; block; block = block->next) {
+            DSA_COUNT(pointerHops);
+            const T* items = block->items();
+            for (uint32_t i = 0; i < block->count; i++) {
+                DSA_COUNT(comparisons);
+                if (items[i] == data) return true;
+            }
         }
-        cout << endl;
+        return false;
+    }
+
+    void clear() {
+        while (head) {
+            Block* next = head->next;
+            destroyBlock(head);
+            head = next;
+        }
+        tail = nullptr;
+        count = 0;
     }
+
+    void display() const {
+        cout << "Linked List: ";
+        for (const T& value : *this) {
+            cout << value << " -> ";
+        }
+        cout << "NULL" << endl;
+    }
+
+    // Reverses the block chain, then the items inside each block
+    void reverse() {
+        Block* prev = nullptr;
+        Block* current = head;
+        tail = head;
+        while (current) {
+            Block* next = current->next;
+            current->next = prev;
+            T* items = current->items();
+            std::reverse(items, items + current->count);
+            prev = current;
+            current = next;
+        }
+        head = prev;
+    }
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(); }
 };
 
 // ==================== BINARY SEARCH TREE ====================
@@ -275,8 +648,13 @@ private:
     TreeNode* root;
 
     TreeNode* insert(TreeNode* node, int data) {
-        if (!node) return new TreeNode(data);
+        if (!node) {
+            DSA_COUNT(nodeAllocations);
+            return new TreeNode(data);
+        }
         
+        DSA_COUNT(comparisons);
+        DSA_COUNT(pointerHops);
         if (data < node->data) {
             node->left = insert(node->left, data);
         } else if (data > node->data) {
@@ -293,6 +671,8 @@ private:
     TreeNode* deleteNode(TreeNode* node, int data) {
         if (!node) return node;
         
+        DSA_COUNT(comparisons);
+        DSA_COUNT(pointerHops);
         if (data < node->data) {
             node->left = deleteNode(node->left, data);
         } else if (data > node->data) {
@@ -341,6 +721,8 @@ private:
 
     bool search(TreeNode* node, int data) {
         if (!node) return false;
+        DSA_COUNT(comparisons);
+        DSA_COUNT(pointerHops);
         if (node->data == data) return true;
         if (data < node->data) return search(node->left, data);
         return search(node->right, data);
@@ -380,23 +762,1001 @@ public:
     }
 };
 
-// ==================== GRAPH (Adjacency List) ====================
-class Graph {
+// ==================== B+ TREE ORDERED SET ====================
+// Balanced replacement for BST with the same insert/remove/find API. Nodes
+// are 256-byte blocks (four cache lines) kept in two contiguous arenas and
+// addressed by index; freed nodes are recycled through free lists. Keys live
+// in the leaves, which are linked in both directions, so range scans walk
+// the leaf chain instead of rebuilding a stack like BSTIterator does.
+class BTreeSet {
+private:
+    static const int LEAF_CAPACITY = 61;
+    static const int INNER_CAPACITY = 31;
+    static const int LEAF_MIN = LEAF_CAPACITY / 2;
+    static const int INNER_MIN = INNER_CAPACITY / 2;
+    static const int MAX_HEIGHT = 32;
+
+    struct alignas(64) Leaf {
+        int keys[LEAF_CAPACITY];
+        int count;
+        int next;
+        int prev;
+    };
+
+    // children[i] holds keys < keys[i]; children[i + 1] holds keys >= keys[i]
+    struct alignas(64) Inner {
+        int keys[INNER_CAPACITY];
+        int children[INNER_CAPACITY + 1];
+        int count;
+    };
+
+    vector<Leaf> leaves;
+    vector<Inner> inners;
+    vector<int> freeLeaves;
+    vector<int> freeInners;
+    int root;
+    int height;       // 0 when the root is a leaf
+    size_t keyCount;
+
+    // Branchless search: number of keys < key (lower) or <= key (upper)
+    static int lowerIndex(const int* keys, int count, int key) {
+        if (count == 0) return 0;
+        const int* base = keys;
+        while (count > 1) {
+            int half = count >> 1;
+            DSA_COUNT(comparisons);
+            base = (base[half] < key) ? base + half : base;
+            count -= half;
+        }
+        return (base - keys) + (*base < key);
+    }
+
+    static int upperIndex(const int* keys, int count, int key) {
+        if (count == 0) return 0;
+        const int* base = keys;
+        while (count > 1) {
+            int half = count >> 1;
+            DSA_COUNT(comparisons);
+            base = (base[half] <= key) ? base + half : base;
+            count -= half;
+        }
+        return (base - keys) + (*base <= key);
+    }
+
+    int allocLeaf() {
+        DSA_COUNT(nodeAllocations);
+        int id;
+        if (!freeLeaves.empty()) {
+            id = freeLeaves.back();
+            freeLeaves.pop_back();
+        } else {
+            id = leaves.size();
+            leaves.emplace_back();
+        }
+        leaves[id].count = 0;
+        leaves[id].next = leaves[id].prev = -1;
+        return id;
+    }
+
+    int allocInner() {
+        DSA_COUNT(nodeAllocations);
+        int id;
+        if (!freeInners.empty()) {
+            id = freeInners.back();
+            freeInners.pop_back();
+        } else {
+            id = inners.size();
+            inners.emplace_back();
+        }
+        inners[id].count = 0;
+        return id;
+    }
+
+    // Descends to the leaf that owns key, recording the inner nodes and the
+    // child slot taken at each level
+    int descend(int key, int* path, int* slots) const {
+        int node = root;
+        for (int level = 0; level < height; level++) {
+            DSA_COUNT(pointerHops);
+            const Inner& inner = inners[node];
+            int slot = upperIndex(inner.keys, inner.count, key);
+            if (path) {
+                path[level] = node;
+                slots[level] = slot;
+            }
+            node = inner.children[slot];
+        }
+        return node;
+    }
+
+    // Inserts separator/right child pair at position slot of an inner node
+    static void insertIntoInner(Inner& inner, int slot, int separator, int rightChild) {
+        for (int i = inner.count; i > slot; i--) {
+            inner.keys[i] = inner.keys[i - 1];
+            inner.children[i + 1] = inner.children[i];
+        }
+        inner.keys[slot] = separator;
+        inner.children[slot + 1] = rightChild;
+        inner.count++;
+    }
+
+    static void removeFromInner(Inner& inner, int slot) {
+        for (int i = slot; i < inner.count - 1; i++) {
+            inner.keys[i] = inner.keys[i + 1];
+            inner.children[i + 1] = inner.children[i + 2];
+        }
+        inner.count--;
+    }
+
+    // Rebalances child `slot` of inner node `parentId` after an underflow by
+    // borrowing from or merging with a sibling
+    void fixLeafUnderflow(int parentId, int slot) {
+        Inner& parent = inners[parentId];
+        int id = parent.children[slot];
+        if (slot > 0) {
+            int leftId = parent.children[slot - 1];
+            Leaf& left = leaves[leftId];
+            Leaf& leaf = leaves[id];
+            if (left.count > LEAF_MIN) {
+                for (int i = leaf.count; i > 0; i--) leaf.keys[i] = leaf.keys[i - 1];
+                leaf.keys[0] = left.keys[--left.count];
+                leaf.count++;
+                parent.keys[slot - 1] = leaf.keys[0];
+                return;
+            }
+            mergeLeaves(parentId, slot - 1);
+            return;
+        }
+        int rightId = parent.children[slot + 1];
+        Leaf& right = leaves[rightId];
+        Leaf& leaf = leaves[id];
+        if (right.count > LEAF_MIN) {
+            leaf.keys[leaf.count++] = right.keys[0];
+            for (int i = 0; i < right.count - 1; i++) right.keys[i] = right.keys[i + 1];
+            right.count--;
+            parent.keys[slot] = right.keys[0];
+            return;
+        }
+        mergeLeaves(parentId, slot);
+    }
+
+    // Appends child slot + 1 into child slot and frees it
+    void mergeLeaves(int parentId, int slot) {
+        Inner& parent = inners[parentId];
+        int leftId = parent.children[slot];
+        int rightId = parent.children[slot + 1];
+        Leaf& left = leaves[leftId];
+        Leaf& right = leaves[rightId];
+        for (int i = 0; i < right.count; i++) left.keys[left.count++] = right.keys[i];
+        left.next = right.next;
+        if (right.next != -1) leaves[right.next].prev = leftId;
+        freeLeaves.push_back(rightId);
+        removeFromInner(parent, slot);
+    }
+
+    void fixInnerUnderflow(int parentId, int slot) {
+        Inner& parent = inners[parentId];
+        int id = parent.children[slot];
+        if (slot > 0) {
+            Inner& left = inners[parent.children[slot - 1]];
+            Inner& node = inners[id];
+            if (left.count > INNER_MIN) {
+                for (int i = node.count; i > 0; i--) node.keys[i] = node.keys[i - 1];
+                for (int i = node.count + 1; i > 0; i--) node.children[i] = node.children[i - 1];
+                node.keys[0] = parent.keys[slot - 1];
+                node.children[0] = left.children[left.count];
+                node.count++;
+                parent.keys[slot - 1] = left.keys[--left.count];
+                return;
+            }
+            mergeInners(parentId, slot - 1);
+            return;
+        }
+        Inner& right = inners[parent.children[slot + 1]];
+        Inner& node = inners[id];
+        if (right.count > INNER_MIN) {
+            node.keys[node.count] = parent.keys[slot];
+            node.children[node.count + 1] = right.children[0];
+            node.count++;
+            parent.keys[slot] = right.keys[0];
+            for (int i = 0; i < right.count - 1; i++) right.keys[i] = right.keys[i + 1];
+            for (int i = 0; i < right.count; i++) right.children[i] = right.children[i + 1];
+            right.count--;
+            return;
+        }
+        mergeInners(parentId, slot);
+    }
+
+    void mergeInners(int parentId, int slot) {
+        Inner& parent = inners[parentId];
+        int rightId = parent.children[slot + 1];
+        Inner& left = inners[parent.children[slot]];
+        Inner& right = inners[rightId];
+        left.keys[left.count] = parent.keys[slot];
+        for (int i = 0; i < right.count; i++) left.keys[left.count + 1 + i] = right.keys[i];
+        for (int i = 0; i <= right.count; i++) left.children[left.count + 1 + i] = right.children[i];
+        left.count += right.count + 1;
+        freeInners.push_back(rightId);
+        removeFromInner(parent, slot);
+    }
+
+public:
+    BTreeSet() : height(0), keyCount(0) {
+        root = allocLeaf();
+    }
+
+    size_t size() const {
+        return keyCount;
+    }
+
+    bool find(int key) const {
+        const Leaf& leaf = leaves[descend(key, nullptr, nullptr)];
+        int i = lowerIndex(leaf.keys, leaf.count, key);
+        return i < leaf.count && leaf.keys[i] == key;
+    }
+
+    // Returns false if the key was already present
+    bool insert(int key) {
+        int path[MAX_HEIGHT], slots[MAX_HEIGHT];
+        int leafId = descend(key, path, slots);
+        {
+            Leaf& leaf = leaves[leafId];
+            int i = lowerIndex(leaf.keys, leaf.count, key);
+            if (i < leaf.count && leaf.keys[i] == key) return false;
+            keyCount++;
+            if (leaf.count < LEAF_CAPACITY) {
+                for (int j = leaf.count; j > i; j--) leaf.keys[j] = leaf.keys[j - 1];
+                leaf.keys[i] = key;
+                leaf.count++;
+                return true;
+            }
+        }
+
+        // Split the full leaf: upper half moves to a new right sibling
+        int rightId = allocLeaf();
+        Leaf& leaf = leaves[leafId];
+        Leaf& right = leaves[rightId];
+        int keys[LEAF_CAPACITY + 1];
+        int i = lowerIndex(leaf.keys, leaf.count, key);
+        copy(leaf.keys, leaf.keys + i, keys);
+        keys[i] = key;
+        copy(leaf.keys + i, leaf.keys + leaf.count, keys + i + 1);
+        int total = LEAF_CAPACITY + 1;
+        leaf.count = total / 2;
+        right.count = total - leaf.count;
+        copy(keys, keys + leaf.count, leaf.keys);
+        copy(keys + leaf.count, keys + total, right.keys);
+        right.next = leaf.next;
+        right.prev = leafId;
+        if (leaf.next != -1) leaves[leaf.next].prev = rightId;
+        leaf.next = rightId;
+
+        int separator = right.keys[0];
+        int newChild = rightId;
+        // Push the separator up, splitting full inner nodes on the way
+        for (int level = height - 1; level >= 0; level--) {
+            int innerId = path[level];
+            if (inners[innerId].count < INNER_CAPACITY) {
+                insertIntoInner(inners[innerId], slots[level], separator, newChild);
+                return true;
+            }
+            int siblingId = allocInner();
+            Inner& inner = inners[innerId];
+            Inner& sibling = inners[siblingId];
+            int innerKeys[INNER_CAPACITY + 1], innerChildren[INNER_CAPACITY + 2];
+            int slot = slots[level];
+            copy(inner.keys, inner.keys + slot, innerKeys);
+            innerKeys[slot] = separator;
+            copy(inner.keys + slot, inner.keys + inner.count, innerKeys + slot + 1);
+            copy(inner.children, inner.children + slot + 1, innerChildren);
+            innerChildren[slot + 1] = newChild;
+            copy(inner.children + slot + 1, inner.children + inner.count + 1, innerChildren + slot + 2);
+
+            // The middle key moves up instead of staying in either half
+            int keyTotal = INNER_CAPACITY + 1;
+            int mid = keyTotal / 2;
+            inner.count = mid;
+            copy(innerKeys, innerKeys + mid, inner.keys);
+            copy(innerChildren, innerChildren + mid + 1, inner.children);
+            sibling.count = keyTotal - mid - 1;
+            copy(innerKeys + mid + 1, innerKeys + keyTotal, sibling.keys);
+            copy(innerChildren + mid + 1, innerChildren + keyTotal + 1, sibling.children);
+            separator = innerKeys[mid];
+            newChild = siblingId;
+        }
+
+        // The root itself split: grow the tree by one level
+        int newRoot = allocInner();
+        Inner& top = inners[newRoot];
+        top.count = 1;
+        top.keys[0] = separator;
+        top.children[0] = root;
+        top.children[1] = newChild;
+        root = newRoot;
+        height++;
+        return true;
+    }
+
+    // Returns false if the key was not present
+    bool remove(int key) {
+        int path[MAX_HEIGHT], slots[MAX_HEIGHT];
+        int leafId = descend(key, path, slots);
+        Leaf& leaf = leaves[leafId];
+        int i = lowerIndex(leaf.keys, leaf.count, key);
+        if (i == leaf.count || leaf.keys[i] != key) return false;
+        for (int j = i; j < leaf.count - 1; j++) leaf.keys[j] = leaf.keys[j + 1];
+        leaf.count--;
+        keyCount--;
+
+        if (height == 0 || leaf.count >= LEAF_MIN) return true;
+        fixLeafUnderflow(path[height - 1], slots[height - 1]);
+        for (int level = height - 1; level > 0; level--) {
+            if (inners[path[level]].count >= INNER_MIN) break;
+            fixInnerUnderflow(path[level - 1], slots[level - 1]);
+        }
+        // An inner root left with a single child hands the root down
+        if (inners[root].count == 0) {
+            freeInners.push_back(root);
+            root = inners[root].children[0];
+            height--;
+        }
+        return true;
+    }
+
+    void inorderTraversal() const {
+        cout << "Inorder: ";
+        for (Iterator it = scan(); it.hasNext();) {
+            cout << it.next() << " ";
+        }
+        cout << endl;
+    }
+
+    // ---------- Range iterators ----------
+    // Same hasNext()/next() shape as BSTIterator, positioned by lower/upper
+    // bound; O(1) amortized per step with no stack. Invalidated by writes.
+    class Iterator {
+    private:
+        const BTreeSet* set;
+        int leaf;
+        int slot;
+        bool reverse;
+
+        // Moves to a valid position, hopping over leaf boundaries
+        void settle() {
+            if (!reverse) {
+                while (leaf != -1 && slot >= set->leaves[leaf].count) {
+                    leaf = set->leaves[leaf].next;
+                    slot = 0;
+                }
+            } else {
+                while (leaf != -1 && slot < 0) {
+                    leaf = set->leaves[leaf].prev;
+                    slot = leaf != -1 ? set->leaves[leaf].count - 1 : 0;
+                }
+            }
+        }
+
+    public:
+        Iterator(const BTreeSet* owner, int leafId, int position, bool descending)
+            : set(owner), leaf(leafId), slot(position), reverse(descending) {
+            settle();
+        }
+
+        bool hasNext() const {
+            return leaf != -1;
+        }
+
+        int next() {
+            int key = set->leaves[leaf].keys[slot];
+            slot += reverse ? -1 : 1;
+            settle();
+            return key;
+        }
+    };
+
+    // All keys, ascending or (reverse) descending
+    Iterator scan(bool reverse = false) const {
+        int node = root;
+        for (int level = 0; level < height; level++) {
+            node = inners[node].children[reverse ? inners[node].count : 0];
+        }
+        return Iterator(this, node, reverse ? leaves[node].count - 1 : 0, reverse);
+    }
+
+    // Ascending from the first key >= key
+    Iterator lowerBound(int key) const {
+        int leafId = descend(key, nullptr, nullptr);
+        return Iterator(this, leafId, lowerIndex(leaves[leafId].keys, leaves[leafId].count, key), false);
+    }
+
+    // Ascending from the first key > key
+    Iterator upperBound(int key) const {
+        int leafId = descend(key, nullptr, nullptr);
+        return Iterator(this, leafId, upperIndex(leaves[leafId].keys, leaves[leafId].count, key), false);
+    }
+
+    // Descending from the last key <= key
+    Iterator reverseFrom(int key) const {
+        int leafId = descend(key, nullptr, nullptr);
+        return Iterator(this, leafId, upperIndex(leaves[leafId].keys, leaves[leafId].count, key) - 1, true);
+    }
+};
+
+// ==================== EYTZINGER STATIC INDEX ====================
+// Read-mostly bulk-built index: sorted keys laid out in BFS (Eytzinger) order
+// in one array, so the top levels of every search share the same cache lines
+// and the descent compiles to a branch-free loop with prefetching.
+class EytzingerIndex {
 private:
+    vector<int> tree;   // 1-based; tree[0] unused
+
+    size_t fill(const vector<int>& sorted, size_t next, size_t k) {
+        if (k < tree.size()) {
+            next = fill(sorted, next, 2 * k);
+            tree[k] = sorted[next++];
+            next = fill(sorted, next, 2 * k + 1);
+        }
+        return next;
+    }
+
+    // Eytzinger slot of the first key >= key, or 0 if none
+    size_t lowerSlot(int key) const {
+        size_t n = tree.size() - 1;
+        size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(tree.data() + (k * 16 < tree.size() ? k * 16 : 0));
+            DSA_COUNT(comparisons);
+            k = 2 * k + (tree[k] < key);
+        }
+        // Undo the trailing right turns plus the final left turn
+        k >>= __builtin_ffsll(~k);
+        return k;
+    }
+
+public:
+    // Keys need not be sorted or unique
+    EytzingerIndex(vector<int> keys = vector<int>()) {
+        sort(keys.begin(), keys.end());
+        keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        tree.assign(keys.size() + 1, 0);
+        fill(keys, 0, 1);
+    }
+
+    // Bulk build from the contents of a BTreeSet (already sorted and unique)
+    static EytzingerIndex fromSet(const BTreeSet& set) {
+        vector<int> keys;
+        keys.reserve(set.size());
+        for (BTreeSet::Iterator it = set.scan(); it.hasNext();) {
+            keys.push_back(it.next());
+        }
+        return EytzingerIndex(move(keys));
+    }
+
+    size_t size() const {
+        return tree.size() - 1;
+    }
+
+    bool find(int key) const {
+        size_t k = lowerSlot(key);
+        return k != 0 && tree[k] == key;
+    }
+
+    // Smallest stored key >= key; false if there is none
+    bool lowerBound(int key, int& result) const {
+        size_t k = lowerSlot(key);
+        if (k == 0) return false;
+        result = tree[k];
+        return true;
+    }
+};
+
+// ==================== COMPRESSED GRAPH (CSR) ====================
+// Frozen, read-only adjacency in compressed sparse row form: the neighbors of
+// v are targets[offsets[v] .. offsets[v + 1]). Traversals report vertices
+// through a callback instead of printing. The arrays are either owned or
+// memory-mapped straight from a file written by save().
+class Bitset {
+private:
+    vector<uint64_t> words;
+
+public:
+    Bitset(size_t bits = 0) : words((bits + 63) / 64, 0) {}
+
+    bool test(size_t i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void set(size_t i) {
+        words[i >> 6] |= (uint64_t)1 << (i & 63);
+    }
+};
+
+class CSRGraph {
+private:
+    struct FileHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t vertices;
+        uint64_t edges;
+        uint32_t flags;
+        uint32_t reserved;
+    };
+
+    static const uint32_t FILE_VERSION = 2;
+    static const uint32_t FLAG_DIRECTED = 1;
+
     int vertices;
-    vector<vector<int>> adjList;
+    uint64_t edges;
+    bool directed;
+    vector<uint64_t> offsetStore;
+    vector<int32_t> targetStore;
+    const uint64_t* offsets;
+    const int32_t* targets;
+    void* mapped;
+    size_t mappedBytes;
+
+    void adoptStores() {
+        offsets = offsetStore.data();
+        targets = targetStore.data();
+    }
 
-    void dfsUtil(int v, vector<bool>& visited) {
-        visited[v] = true;
-        cout << v << " ";
-        
-        for (int neighbor : adjList[v]) {
-            if (!visited[neighbor]) {
-                dfsUtil(neighbor, visited);
+    void release() {
+        if (mapped) munmap(mapped, mappedBytes);
+        mapped = nullptr;
+        mappedBytes = 0;
+    }
+
+    // Traversals index with offsets and targets unchecked, so a loaded file
+    // must be a monotone prefix sum from 0 to E with every target below V
+    static bool wellFormed(const uint64_t* offsets, const int32_t* targets, int vertexCount, uint64_t edgeCount) {
+        if (offsets[0] != 0 || offsets[vertexCount] != edgeCount) return false;
+        for (int v = 0; v < vertexCount; v++) {
+            if (offsets[v + 1] < offsets[v]) return false;
+        }
+        for (uint64_t e = 0; e < edgeCount; e++) {
+            if (targets[e] < 0 || targets[e] >= vertexCount) return false;
+        }
+        return true;
+    }
+
+public:
+    // Direction-optimizing BFS switches to bottom-up once the frontier's edges
+    // exceed 1/ALPHA of the unexplored edges, and back below n/BETA vertices
+    static const int BFS_ALPHA = 14;
+    static const int BFS_BETA = 24;
+    static const size_t SERIAL_FRONTIER = 1024;
+
+    CSRGraph() : vertices(0), edges(0), directed(false), offsetStore(1, 0), mapped(nullptr), mappedBytes(0) {
+        adoptStores();
+    }
+
+    // Keeps the neighbor order of the adjacency lists, so traversals visit
+    // vertices in the same order as Graph::bfs()/dfs(). Lists are taken as
+    // directed unless the caller knows every edge is stored both ways.
+    CSRGraph(const vector<vector<int>>& adjList, bool isDirected = true) : CSRGraph() {
+        vertices = adjList.size();
+        directed = isDirected;
+        offsetStore.assign(vertices + 1, 0);
+        for (int v = 0; v < vertices; v++) {
+            offsetStore[v + 1] = offsetStore[v] + adjList[v].size();
+        }
+        edges = offsetStore[vertices];
+        targetStore.resize(edges);
+        for (int v = 0; v < vertices; v++) {
+            copy(adjList[v].begin(), adjList[v].end(), targetStore.begin() + offsetStore[v]);
+        }
+        adoptStores();
+    }
+
+    // Builds straight from an edge list with a counting sort, without the
+    // per-vertex vectors; undirected edges are stored in both directions
+    static CSRGraph fromEdges(int vertexCount, const vector<pair<int, int>>& edgeList, bool undirected = true) {
+        CSRGraph graph;
+        graph.vertices = vertexCount;
+        graph.directed = !undirected;
+        graph.offsetStore.assign(vertexCount + 1, 0);
+        for (const auto& e : edgeList) {
+            graph.offsetStore[e.first + 1]++;
+            if (undirected) graph.offsetStore[e.second + 1]++;
+        }
+        for (int v = 0; v < vertexCount; v++) {
+            graph.offsetStore[v + 1] += graph.offsetStore[v];
+        }
+        graph.edges = graph.offsetStore[vertexCount];
+        graph.targetStore.resize(graph.edges);
+        vector<uint64_t> fill(graph.offsetStore.begin(), graph.offsetStore.end() - 1);
+        for (const auto& e : edgeList) {
+            graph.targetStore[fill[e.first]++] = e.second;
+            if (undirected) graph.targetStore[fill[e.second]++] = e.first;
+        }
+        graph.adoptStores();
+        return graph;
+    }
+
+    CSRGraph(const CSRGraph&) = delete;
+    CSRGraph& operator=(const CSRGraph&) = delete;
+
+    CSRGraph(CSRGraph&& other) noexcept : mapped(nullptr), mappedBytes(0) {
+        *this = move(other);
+    }
+
+    CSRGraph& operator=(CSRGraph&& other) noexcept {
+        if (this != &other) {
+            release();
+            vertices = other.vertices;
+            edges = other.edges;
+            directed = other.directed;
+            offsetStore = move(other.offsetStore);
+            targetStore = move(other.targetStore);
+            offsets = other.offsets;
+            targets = other.targets;
+            mapped = other.mapped;
+            mappedBytes = other.mappedBytes;
+            other.mapped = nullptr;
+            other.mappedBytes = 0;
+            other.vertices = 0;
+            other.edges = 0;
+            other.offsetStore.assign(1, 0);
+            other.adoptStores();
+        }
+        return *this;
+    }
+
+    ~CSRGraph() {
+        release();
+    }
+
+    int vertexCount() const {
+        return vertices;
+    }
+
+    uint64_t edgeCount() const {
+        return edges;
+    }
+
+    uint64_t degree(int v) const {
+        return offsets[v + 1] - offsets[v];
+    }
+
+    bool isDirected() const {
+        return directed;
+    }
+
+    // ---------- Binary file format ----------
+    // 32-byte header, then (vertices + 1) uint64 offsets, then int32 targets.
+    // Every array stays 8-byte aligned, so load() can use the mapping as is.
+    // Version 2 added the flags word (FLAG_DIRECTED); version 1 is rejected.
+    bool save(const string& path) const {
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file) {
+            cout << "Cannot open file: " << path << endl;
+            return false;
+        }
+        FileHeader header = {{'C', 'S', 'R', 'G'}, FILE_VERSION, (uint64_t)vertices, edges,
+                             directed ? FLAG_DIRECTED : 0, 0};
+        bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  fwrite(offsets, sizeof(uint64_t), vertices + 1, file) == (size_t)vertices + 1 &&
+                  fwrite(targets, sizeof(int32_t), edges, file) == edges;
+        fclose(file);
+        return ok;
+    }
+
+    static CSRGraph load(const string& path) {
+        CSRGraph graph;
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            cout << "Cannot open file: " << path << endl;
+            return graph;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            cout << "Cannot stat file: " << path << endl;
+            close(fd);
+            return graph;
+        }
+        size_t bytes = info.st_size;
+        void* data = bytes >= sizeof(FileHeader) ? mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        close(fd);
+        if (data == MAP_FAILED) {
+            cout << "Cannot map graph file: " << path << endl;
+            return graph;
+        }
+
+        // Vertex ids are int, and the counts are bounded by the file size
+        // before they are multiplied, so the size check cannot overflow
+        const FileHeader* header = (const FileHeader*)data;
+        bool valid = memcmp(header->magic, "CSRG", 4) == 0 && header->version == FILE_VERSION &&
+                     (header->flags & ~FLAG_DIRECTED) == 0 && header->vertices <= (uint64_t)INT_MAX &&
+                     header->edges <= bytes / sizeof(int32_t);
+        if (valid) {
+            size_t expected = sizeof(FileHeader) + (header->vertices + 1) * sizeof(uint64_t) +
+                              header->edges * sizeof(int32_t);
+            valid = bytes == expected;
+        }
+        const uint64_t* offsets = (const uint64_t*)((const char*)data + sizeof(FileHeader));
+        const int32_t* targets = valid ? (const int32_t*)(offsets + header->vertices + 1) : nullptr;
+        if (!valid || !wellFormed(offsets, targets, (int)header->vertices, header->edges)) {
+            cout << "Invalid graph file: " << path << endl;
+            munmap(data, bytes);
+            return graph;
+        }
+
+        graph.mapped = data;
+        graph.mappedBytes = bytes;
+        graph.vertices = (int)header->vertices;
+        graph.edges = header->edges;
+        graph.directed = (header->flags & FLAG_DIRECTED) != 0;
+        graph.offsets = offsets;
+        graph.targets = targets;
+        return graph;
+    }
+
+    // ---------- Traversals ----------
+    template<typename Visit>
+    void bfs(int start, Visit visit) const {
+        Bitset visited(vertices);
+        vector<int> queue;
+        queue.reserve(vertices);
+        visited.set(start);
+        queue.push_back(start);
+        for (size_t head = 0; head < queue.size(); head++) {
+            int current = queue[head];
+            visit(current);
+            for (uint64_t e = offsets[current]; e < offsets[current + 1]; e++) {
+                DSA_COUNT(pointerHops);
+                int neighbor = targets[e];
+                if (!visited.test(neighbor)) {
+                    visited.set(neighbor);
+                    queue.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    // Explicit stack of (vertex, next edge) pairs: same order as the recursive
+    // version, but path length is bounded by memory rather than the call stack
+    template<typename Visit>
+    void dfs(int start, Visit visit) const {
+        Bitset visited(vertices);
+        vector<pair<int, uint64_t>> stack;
+        visited.set(start);
+        visit(start);
+        stack.push_back({start, offsets[start]});
+        while (!stack.empty()) {
+            pair<int, uint64_t>& top = stack.back();
+            if (top.second == offsets[top.first + 1]) {
+                stack.pop_back();
+                continue;
+            }
+            DSA_COUNT(pointerHops);
+            int neighbor = targets[top.second++];
+            if (!visited.test(neighbor)) {
+                visited.set(neighbor);
+                visit(neighbor);
+                stack.push_back({neighbor, offsets[neighbor]});
+            }
+        }
+    }
+
+    void bfs(int start, vector<int>& order) const {
+        order.clear();
+        bfs(start, [&](int v) { order.push_back(v); });
+    }
+
+    void dfs(int start, vector<int>& order) const {
+        order.clear();
+        dfs(start, [&](int v) { order.push_back(v); });
+    }
+
+    // ---------- Parallel direction-optimizing BFS ----------
+    // Returns the BFS level of every vertex (-1 if unreachable). Top-down
+    // levels split the frontier across threads and claim vertices with an
+    // atomic bitset; bottom-up levels give each thread a 64-aligned range of
+    // unvisited vertices that look for any parent in the frontier bitset.
+    // Bottom-up scans a vertex's out-edges for a parent, which only finds
+    // in-edges when adjacency is symmetric: directed graphs stay top-down.
+    vector<int> parallelBfs(int start, int threadCount = 0) const {
+        vector<int> depth(vertices, -1);
+        if (vertices == 0) return depth;
+        if (threadCount <= 0) threadCount = max(1u, thread::hardware_concurrency());
+
+        size_t words = (vertices + 63) / 64;
+        vector<atomic<uint64_t>> visited(words);
+        for (auto& w : visited) w.store(0, memory_order_relaxed);
+        vector<uint64_t> frontierBits(words, 0), nextBits(words, 0);
+        vector<int> frontier = {start};
+        vector<vector<int>> localNext(threadCount);
+        vector<uint64_t> localCount(threadCount), localDegree(threadCount);
+
+        visited[start >> 6].fetch_or((uint64_t)1 << (start & 63), memory_order_relaxed);
+        depth[start] = 0;
+
+        // Shared control state, written by thread 0 between barriers only
+        int level = 0;
+        bool bottomUp = false;
+        bool done = false;
+        uint64_t frontierSize = 1;
+        uint64_t frontierEdges = degree(start);
+        uint64_t unexploredEdges = edges - frontierEdges;
+
+        auto claim = [&](int v) {
+            uint64_t bit = (uint64_t)1 << (v & 63);
+            if (visited[v >> 6].load(memory_order_relaxed) & bit) return false;
+            return !(visited[v >> 6].fetch_or(bit, memory_order_relaxed) & bit);
+        };
+
+        auto topDown = [&](int tid) {
+            localNext[tid].clear();
+            localDegree[tid] = 0;
+            size_t from = frontier.size() * tid / threadCount;
+            size_t to = frontier.size() * (tid + 1) / threadCount;
+            for (size_t i = from; i < to; i++) {
+                int u = frontier[i];
+                for (uint64_t e = offsets[u]; e < offsets[u + 1]; e++) {
+                    int v = targets[e];
+                    if (claim(v)) {
+                        depth[v] = level + 1;
+                        localNext[tid].push_back(v);
+                        localDegree[tid] += degree(v);
+                    }
+                }
+            }
+        };
+
+        auto bottomUpStep = [&](int tid) {
+            localCount[tid] = 0;
+            localDegree[tid] = 0;
+            size_t fromWord = words * tid / threadCount;
+            size_t toWord = words * (tid + 1) / threadCount;
+            for (size_t w = fromWord; w < toWord; w++) {
+                nextBits[w] = 0;
+                uint64_t unvisited = ~visited[w].load(memory_order_relaxed);
+                for (; unvisited; unvisited &= unvisited - 1) {
+                    int v = (int)(w * 64 + __builtin_ctzll(unvisited));
+                    if (v >= vertices) break;
+                    for (uint64_t e = offsets[v]; e < offsets[v + 1]; e++) {
+                        int u = targets[e];
+                        if ((frontierBits[u >> 6] >> (u & 63)) & 1) {
+                            depth[v] = level + 1;
+                            nextBits[w] |= (uint64_t)1 << (v & 63);
+                            localCount[tid]++;
+                            localDegree[tid] += degree(v);
+                            break;
+                        }
+                    }
+                }
+                visited[w].fetch_or(nextBits[w], memory_order_relaxed);
+            }
+        };
+
+        // Small frontiers (long paths, the first and last levels) are cheaper
+        // to expand on one thread than to synchronize for
+        auto serialLevels = [&]() {
+            while (!frontier.empty() && frontier.size() < SERIAL_FRONTIER) {
+                vector<int> next;
+                uint64_t nextEdges = 0;
+                for (int u : frontier) {
+                    for (uint64_t e = offsets[u]; e < offsets[u + 1]; e++) {
+                        int v = targets[e];
+                        if (claim(v)) {
+                            depth[v] = level + 1;
+                            next.push_back(v);
+                            nextEdges += degree(v);
+                        }
+                    }
+                }
+                frontier.swap(next);
+                frontierSize = frontier.size();
+                frontierEdges = nextEdges;
+                unexploredEdges -= min(unexploredEdges, nextEdges);
+                level++;
+            }
+        };
+
+        // Runs on thread 0 after every parallel step
+        auto advance = [&]() {
+            uint64_t previousSize = frontierSize;
+            frontierSize = 0;
+            frontierEdges = 0;
+            for (int t = 0; t < threadCount; t++) {
+                frontierSize += bottomUp ? localCount[t] : localNext[t].size();
+                frontierEdges += localDegree[t];
             }
+            unexploredEdges -= min(unexploredEdges, frontierEdges);
+            level++;
+
+            if (bottomUp) {
+                frontierBits.swap(nextBits);
+                if (frontierSize < (uint64_t)vertices / BFS_BETA && frontierSize < previousSize) {
+                    frontier.clear();
+                    for (size_t w = 0; w < words; w++) {
+                        for (uint64_t bits = frontierBits[w]; bits; bits &= bits - 1) {
+                            frontier.push_back((int)(w * 64 + __builtin_ctzll(bits)));
+                        }
+                    }
+                    bottomUp = false;
+                }
+            } else {
+                frontier.clear();
+                for (int t = 0; t < threadCount; t++) {
+                    frontier.insert(frontier.end(), localNext[t].begin(), localNext[t].end());
+                }
+            }
+
+            if (!bottomUp) {
+                serialLevels();
+                if (!directed && frontierEdges > unexploredEdges / BFS_ALPHA && !frontier.empty()) {
+                    fill(frontierBits.begin(), frontierBits.end(), 0);
+                    for (int v : frontier) frontierBits[v >> 6] |= (uint64_t)1 << (v & 63);
+                    bottomUp = true;
+                }
+            }
+            done = frontierSize == 0 || (!bottomUp && frontier.empty());
+        };
+
+        Barrier barrier(threadCount);
+        auto worker = [&](int tid) {
+            while (true) {
+                barrier.wait();
+                if (done) break;
+                if (bottomUp) bottomUpStep(tid);
+                else topDown(tid);
+                barrier.wait();
+                if (tid == 0) advance();
+            }
+        };
+
+        serialLevels();
+        done = frontier.empty();
+        if (!done && !directed && frontierEdges > unexploredEdges / BFS_ALPHA) {
+            for (int v : frontier) frontierBits[v >> 6] |= (uint64_t)1 << (v & 63);
+            bottomUp = true;
+        }
+
+        vector<thread> pool;
+        for (int t = 1; t < threadCount; t++) {
+            pool.emplace_back(worker, t);
+        }
+        worker(0);
+        for (auto& th : pool) {
+            th.join();
         }
+        return depth;
     }
 
+private:
+    // Reusable barrier: the last thread to arrive starts a new generation
+    class Barrier {
+    private:
+        mutex lock;
+        condition_variable released;
+        int count;
+        int waiting;
+        int generation;
+
+    public:
+        Barrier(int threads) : count(threads), waiting(0), generation(0) {}
+
+        void wait() {
+            unique_lock<mutex> guard(lock);
+            int arrivedIn = generation;
+            if (++waiting == count) {
+                waiting = 0;
+                generation++;
+                released.notify_all();
+            } else {
+                released.wait(guard, [&]() { return generation != arrivedIn; });
+            }
+        }
+    };
+};
+
+// ==================== GRAPH (Adjacency List) ====================
+class Graph {
+private:
+    int vertices;
+    vector<vector<int>> adjList;
+
 public:
     Graph(int v) : vertices(v) {
         adjList.resize(v);
@@ -407,10 +1767,37 @@ public:
         adjList[dest].push_back(src); // For undirected graph
     }
 
+    // Frozen CSR copy for fast, repeated traversals
+    CSRGraph freeze() const {
+        return CSRGraph(adjList, false);
+    }
+
+    // Iterative: an explicit stack of (vertex, next neighbor) keeps the
+    // recursive visiting order without overflowing on long paths
     void dfs(int start) {
         vector<bool> visited(vertices, false);
+        vector<pair<int, size_t>> stack;
         cout << "DFS traversal: ";
-        dfsUtil(start, visited);
+        
+        visited[start] = true;
+        cout << start << " ";
+        stack.push_back({start, 0});
+        
+        while (!stack.empty()) {
+            int current = stack.back().first;
+            size_t& next = stack.back().second;
+            if (next == adjList[current].size()) {
+                stack.pop_back();
+                continue;
+            }
+            DSA_COUNT(pointerHops);
+            int neighbor = adjList[current][next++];
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                cout << neighbor << " ";
+                stack.push_back({neighbor, 0});
+            }
+        }
         cout << endl;
     }
 
@@ -423,12 +1810,13 @@ public:
         
         cout << "BFS traversal: ";
         
-        while (!queue.empty()) {
-            int current = queue[0];
+        // Advance a head index instead of erasing from the front: O(V + E)
+        for (size_t head = 0; head < queue.size(); head++) {
+            int current = queue[head];
             cout << current << " ";
-            queue.erase(queue.begin());
             
             for (int neighbor : adjList[current]) {
+                DSA_COUNT(pointerHops);
                 if (!visited[neighbor]) {
                     visited[neighbor] = true;
                     queue.push_back(neighbor);
@@ -451,57 +1839,325 @@ public:
 };
 
 // ==================== SORTING ALGORITHMS ====================
+// Templated on element type and comparator. Merge sorts are stable and need
+// a default-constructible T for their scratch buffer; quickSort() is an
+// introsort (quick sort that falls back to heap sort on bad pivots);
+// radixSort() handles 32/64-bit integer keys in ascending order.
 class Sorting {
 public:
+    static const int INSERTION_SORT_CUTOFF = 24;
+    static const size_t RADIX_SORT_THRESHOLD = 256;
+    static const size_t PARALLEL_MIN_PER_THREAD = 1 << 16;
+
+    // ---------- Merge Sort ----------
+    // One scratch buffer for the whole sort, insertion sort on short runs and
+    // no merge at all when the two halves are already in order
+    template<typename T, typename Compare = less<T>>
+    static void mergeSort(vector<T>& arr, int left, int right, Compare comp = Compare()) {
+        if (left >= right) return;
+        vector<T> scratch((right - left + 2) / 2);
+        mergeSortRange(arr.data(), left, right, scratch.data(), comp);
+    }
+
+    template<typename T, typename Compare = less<T>>
+    static void mergeSort(vector<T>& arr, Compare comp = Compare()) {
+        mergeSort(arr, 0, (int)arr.size() - 1, comp);
+    }
 
-    static void mergeSort(vector<int>& arr, int left, int right) {
-        if (left < right) {
-            int mid = left + (right - left) / 2;
-            mergeSort(arr, left, mid);
-            mergeSort(arr, mid + 1, right);
-            merge(arr, left, mid, right);
+    // Merges the sorted ranges [left, mid] and [mid + 1, right]
+    template<typename T, typename Compare = less<T>>
+    static void merge(vector<T>& arr, int left, int mid, int right, Compare comp = Compare()) {
+        vector<T> scratch(mid - left + 1);
+        mergeRuns(arr.data(), left, mid, right, scratch.data(), comp);
+    }
+
+    // ---------- Quick Sort (introsort) ----------
+    template<typename T, typename Compare = less<T>>
+    static void quickSort(vector<T>& arr, Compare comp = Compare()) {
+        if (arr.size() < 2) return;
+        int depthLimit = 2 * floorLog2(arr.size());
+        introsort(arr.data(), arr.data() + arr.size(), depthLimit, comp);
+    }
+
+    // ---------- LSD Radix Sort ----------
+    // Ascending order for 32/64-bit integers, one byte per pass. Signed keys
+    // are biased so negative values come first; passes where every key shares
+    // the same byte are skipped.
+    template<typename T>
+    static void radixSort(vector<T>& arr) {
+        static_assert(is_integral<T>::value && (sizeof(T) == 4 || sizeof(T) == 8),
+                      "radixSort supports 32/64-bit integer keys");
+        typedef typename make_unsigned<T>::type Key;
+        const Key bias = is_signed<T>::value ? (Key)1 << (sizeof(T) * 8 - 1) : 0;
+        size_t n = arr.size();
+        if (n < 2) return;
+
+        // Histograms for every byte in a single read of the input
+        vector<size_t> counts(sizeof(T) * 256, 0);
+        for (size_t i = 0; i < n; i++) {
+            Key key = (Key)arr[i] ^ bias;
+            for (size_t b = 0; b < sizeof(T); b++) {
+                counts[b * 256 + ((key >> (b * 8)) & 0xff)]++;
+            }
         }
+
+        vector<T> buffer(n);
+        T* from = arr.data();
+        T* to = buffer.data();
+        for (size_t b = 0; b < sizeof(T); b++) {
+            size_t* count = &counts[b * 256];
+            if (count[((Key)from[0] ^ bias) >> (b * 8) & 0xff] == n) continue;
+
+            size_t offset = 0;
+            for (int digit = 0; digit < 256; digit++) {
+                size_t c = count[digit];
+                count[digit] = offset;
+                offset += c;
+            }
+            for (size_t i = 0; i < n; i++) {
+                Key key = (Key)from[i] ^ bias;
+                to[count[(key >> (b * 8)) & 0xff]++] = from[i];
+            }
+            swap(from, to);
+        }
+        if (from != arr.data()) {
+            copy(from, from + n, arr.data());
+        }
+    }
+
+    // ---------- Parallel Merge Sort ----------
+    // Each thread merge-sorts one chunk, then the output is cut into equal
+    // slices with sampled splitters and every thread k-way merges its own
+    // slice, so both phases scale with the number of cores. Stable.
+    template<typename T, typename Compare = less<T>>
+    static void parallelMergeSort(vector<T>& arr, Compare comp = Compare(), int threadCount = 0) {
+        size_t n = arr.size();
+        if (threadCount <= 0) threadCount = max(1u, thread::hardware_concurrency());
+        threadCount = (int)min<size_t>(threadCount, n / PARALLEL_MIN_PER_THREAD);
+        if (threadCount <= 1) {
+            mergeSort(arr, comp);
+            return;
+        }
+
+        int runs = threadCount;
+        vector<size_t> bounds(runs + 1);
+        for (int r = 0; r <= runs; r++) bounds[r] = n * r / runs;
+
+        // Phase 1: sort the chunks in place; output doubles as scratch space
+        vector<T> output(n);
+        runParallel(runs, [&](int r) {
+            mergeSortRange(arr.data(), (int)bounds[r], (int)bounds[r + 1] - 1, output.data() + bounds[r], comp);
+        });
+
+        // Phase 2: pick threadCount - 1 splitters from a sample of every run.
+        // Elements are ordered by (value, run, position) so equal keys still
+        // split evenly and stay in input order.
+        const int oversample = 16;
+        vector<pair<int, size_t>> samples;
+        for (int r = 0; r < runs; r++) {
+            size_t length = bounds[r + 1] - bounds[r];
+            for (int s = 0; s < threadCount * oversample; s++) {
+                samples.push_back({r, bounds[r] + length * s / (threadCount * oversample)});
+            }
+        }
+        auto sampleLess = [&](const pair<int, size_t>& a, const pair<int, size_t>& b) {
+            if (comp(arr[a.second], arr[b.second])) return true;
+            if (comp(arr[b.second], arr[a.second])) return false;
+            return a < b;
+        };
+        std::sort(samples.begin(), samples.end(), sampleLess);
+
+        // splits[t][r]: first position of run r that belongs to slice t
+        vector<vector<size_t>> splits(threadCount + 1, vector<size_t>(runs));
+        for (int r = 0; r < runs; r++) {
+            splits[0][r] = bounds[r];
+            splits[threadCount][r] = bounds[r + 1];
+        }
+        for (int t = 1; t < threadCount; t++) {
+            pair<int, size_t> splitter = samples[samples.size() * t / threadCount];
+            const T& value = arr[splitter.second];
+            for (int r = 0; r < runs; r++) {
+                T* first = arr.data() + bounds[r];
+                T* last = arr.data() + bounds[r + 1];
+                T* cut;
+                if (r < splitter.first) cut = upper_bound(first, last, value, comp);
+                else if (r > splitter.first) cut = lower_bound(first, last, value, comp);
+                else cut = arr.data() + splitter.second;
+                splits[t][r] = cut - arr.data();
+            }
+        }
+
+        // Phase 3: every thread merges its slice of all runs into output
+        runParallel(threadCount, [&](int t) {
+            size_t offset = 0;
+            for (int r = 0; r < runs; r++) offset += splits[t][r] - bounds[r];
+            multiwayMerge(arr.data(), splits[t], splits[t + 1], output.data() + offset, comp);
+        });
+        arr.swap(output);
     }
 
-    static void merge(vector<int>& arr, int left, int mid, int right) {
+    // ---------- Automatic selection ----------
+    // Radix sort for integer keys in ascending order, parallel merge sort for
+    // large inputs on multi-core machines, introsort otherwise
+    template<typename T, typename Compare = less<T>>
+    static void sort(vector<T>& arr, Compare comp = Compare()) {
+        if (arr.size() <= (size_t)INSERTION_SORT_CUTOFF) {
+            insertionSort(arr.data(), arr.data() + arr.size(), comp);
+            return;
+        }
+        if constexpr (is_integral<T>::value && (sizeof(T) == 4 || sizeof(T) == 8) &&
+                      is_same<Compare, less<T>>::value) {
+            if (arr.size() >= RADIX_SORT_THRESHOLD) {
+                radixSort(arr);
+                return;
+            }
+        }
+        if (thread::hardware_concurrency() > 1 && arr.size() >= 2 * PARALLEL_MIN_PER_THREAD) {
+            parallelMergeSort(arr, comp);
+            return;
+        }
+        quickSort(arr, comp);
+    }
+
+private:
+    static int floorLog2(size_t n) {
+        int log = 0;
+        while (n >>= 1) log++;
+        return log;
+    }
+
+    template<typename T, typename Compare>
+    static void insertionSort(T* first, T* last, Compare comp) {
+        for (T* i = first + 1; i < last; i++) {
+            T value = move(*i);
+            T* j = i;
+            while (j > first && comp(value, *(j - 1))) {
+                DSA_COUNT(comparisons);
+                *j = move(*(j - 1));
+                j--;
+            }
+            *j = move(value);
+        }
+    }
+
+    template<typename T, typename Compare>
+    static void mergeSortRange(T* arr, int left, int right, T* scratch, Compare comp) {
+        if (right - left < INSERTION_SORT_CUTOFF) {
+            insertionSort(arr + left, arr + right + 1, comp);
+            return;
+        }
+        int mid = left + (right - left) / 2;
+        mergeSortRange(arr, left, mid, scratch, comp);
+        mergeSortRange(arr, mid + 1, right, scratch, comp);
+        DSA_COUNT(comparisons);
+        if (comp(arr[mid + 1], arr[mid])) {
+            mergeRuns(arr, left, mid, right, scratch, comp);
+        }
+    }
+
+    // Only the left run is copied out; the merge then fills arr from the left
+    // and can never overtake the unread part of the right run
+    template<typename T, typename Compare>
+    static void mergeRuns(T* arr, int left, int mid, int right, T* scratch, Compare comp) {
         int n1 = mid - left + 1;
-        int n2 = right - mid;
-        
-        vector<int> leftArr(n1), rightArr(n2);
-        
-        for (int i = 0; i < n1; i++)
-            leftArr[i] = arr[left + i];
-        for (int j = 0; j < n2; j++)
-            rightArr[j] = arr[mid + 1 + j];
-        
-        int i = 0, j = 0, k = left;
-        
-        while (i < n1 && j < n2) {
-            if (leftArr[i] <= rightArr[j]) {
-                arr[k] = leftArr[i];
-                i++;
+        move(arr + left, arr + mid + 1, scratch);
+
+        int i = 0, j = mid + 1, k = left;
+        while (i < n1 && j <= right) {
+            DSA_COUNT(comparisons);
+            if (comp(arr[j], scratch[i])) {
+                arr[k++] = move(arr[j++]);
             } else {
-                arr[k] = rightArr[j];
-                j++;
+                arr[k++] = move(scratch[i++]);
             }
-            k++;
         }
-        
         while (i < n1) {
-            arr[k] = leftArr[i];
-            i++;
-            k++;
+            arr[k++] = move(scratch[i++]);
         }
-        
-        while (j < n2) {
-            arr[k] = rightArr[j];
-            j++;
-            k++;
+    }
+
+    template<typename T, typename Compare>
+    static void introsort(T* first, T* last, int depthLimit, Compare comp) {
+        while (last - first > INSERTION_SORT_CUTOFF) {
+            if (depthLimit-- == 0) {
+                make_heap(first, last, comp);
+                sort_heap(first, last, comp);
+                return;
+            }
+            T* cut = partition(first, last, comp);
+            // Recurse into the smaller side to bound the stack at O(log n)
+            if (cut - first < last - cut) {
+                introsort(first, cut, depthLimit, comp);
+                first = cut;
+            } else {
+                introsort(cut, last, depthLimit, comp);
+                last = cut;
+            }
+        }
+        insertionSort(first, last, comp);
+    }
+
+    // Hoare partition around a median-of-three pivot; equal keys are split
+    // evenly between both sides so duplicate-heavy input stays O(n log n)
+    template<typename T, typename Compare>
+    static T* partition(T* first, T* last, Compare comp) {
+        T* mid = first + (last - first) / 2;
+        if (comp(*mid, *first)) swap(*mid, *first);
+        if (comp(*(last - 1), *mid)) {
+            swap(*(last - 1), *mid);
+            if (comp(*mid, *first)) swap(*mid, *first);
+        }
+        T pivot = *mid;
+
+        T* i = first - 1;
+        T* j = last;
+        while (true) {
+            do { i++; DSA_COUNT(comparisons); } while (comp(*i, pivot));
+            do { j--; DSA_COUNT(comparisons); } while (comp(pivot, *j));
+            if (i >= j) return j + 1;
+            swap(*i, *j);
+        }
+    }
+
+    // Merges runs [from[r], to[r]) of arr into out; ties go to the lower run
+    template<typename T, typename Compare>
+    static void multiwayMerge(const T* arr, const vector<size_t>& from, const vector<size_t>& to,
+                              T* out, Compare comp) {
+        vector<size_t> head(from);
+        auto later = [&](int a, int b) {
+            DSA_COUNT(comparisons);
+            if (comp(arr[head[b]], arr[head[a]])) return true;
+            if (comp(arr[head[a]], arr[head[b]])) return false;
+            return a > b;
+        };
+        priority_queue<int, vector<int>, decltype(later)> heap(later);
+        for (size_t r = 0; r < head.size(); r++) {
+            if (head[r] < to[r]) heap.push(r);
+        }
+        while (!heap.empty()) {
+            int r = heap.top();
+            heap.pop();
+            *out++ = arr[head[r]++];
+            if (head[r] < to[r]) heap.push(r);
+        }
+    }
+
+    template<typename Task>
+    static void runParallel(int count, Task task) {
+        vector<thread> pool;
+        for (int i = 1; i < count; i++) {
+            pool.emplace_back(task, i);
+        }
+        task(0);
+        for (auto& th : pool) {
+            th.join();
         }
     }
 };
 
 // ==================== MAIN FUNCTION - DEMO ====================
+// Define DSA_LIBRARY_NO_MAIN to include this file from another program
+#ifndef DSA_LIBRARY_NO_MAIN
 int main() {
     cout << "=== COMPREHENSIVE DSA LIBRARY DEMO ===" << endl;
 
@@ -521,7 +2177,7 @@ int main() {
 
     // Linked List Demo
     cout << "\n--- Linked List Operations ---" << endl;
-    LinkedList ll;
+    LinkedList<int> ll;
     ll.insertEnd(1);
     ll.insertEnd(2);
     ll.insertEnd(3);
@@ -533,22 +2189,24 @@ int main() {
 
     // Stack Demo
     cout << "\n--- Stack Operations ---" << endl;
-    Stack stack(5);
+    Stack<int> stack(5);
     stack.push(10);
     stack.push(20);
     stack.push(30);
     stack.display();
-    cout << "Popped: " << stack.pop() << endl;
+    int popped;
+    if (stack.pop(popped)) cout << "Popped: " << popped << endl;
     stack.display();
 
     // Queue Demo
     cout << "\n--- Queue Operations ---" << endl;
-    Queue queue(5);
+    Queue<int> queue(5);
     queue.enqueue(10);
     queue.enqueue(20);
     queue.enqueue(30);
     queue.display();
-    cout << "Dequeued: " << queue.dequeue() << endl;
+    int dequeued;
+    if (queue.dequeue(dequeued)) cout << "Dequeued: " << dequeued << endl;
     queue.display();
 
     // BST Demo
@@ -566,6 +2224,23 @@ int main() {
     bst.postorderTraversal();
     cout << "Search 40: " << (bst.find(40) ? "Found" : "Not Found") << endl;
 
+    // Balanced B+ tree: same API, plus range scans over the leaf chain
+    cout << "\n--- B+ Tree Ordered Set Operations ---" << endl;
+    BTreeSet set;
+    for (int key : {50, 30, 70, 20, 40, 60, 80}) set.insert(key);
+    set.remove(70);
+    set.inorderTraversal();
+    cout << "Search 40: " << (set.find(40) ? "Found" : "Not Found") << endl;
+    cout << "Keys >= 35: ";
+    for (BTreeSet::Iterator it = set.lowerBound(35); it.hasNext();) cout << it.next() << " ";
+    cout << endl;
+    cout << "Keys <= 55, descending: ";
+    for (BTreeSet::Iterator it = set.reverseFrom(55); it.hasNext();) cout << it.next() << " ";
+    cout << endl;
+    EytzingerIndex index = EytzingerIndex::fromSet(set);
+    int successor;
+    if (index.lowerBound(45, successor)) cout << "Static index lower bound of 45: " << successor << endl;
+
     // Graph Demo
     cout << "\n--- Graph Operations ---" << endl;
     Graph graph(5);
@@ -580,6 +2255,40 @@ int main() {
     graph.dfs(0);
     graph.bfs(0);
 
+    // Frozen CSR form: callbacks instead of printing, binary save/load
+    CSRGraph csr = graph.freeze();
+    vector<int> order;
+    csr.bfs(0, order);
+    cout << "CSR BFS order: ";
+    for (int v : order) cout << v << " ";
+    cout << endl;
+    cout << "CSR DFS order: ";
+    csr.dfs(0, [](int v) { cout << v << " "; });
+    cout << endl;
+
+    csr.save("graph.csr");
+    CSRGraph loaded = CSRGraph::load("graph.csr");
+    vector<int> levels = loaded.parallelBfs(0);
+    cout << "Parallel BFS levels (loaded from file): ";
+    for (int v = 0; v < loaded.vertexCount(); v++) cout << v << ":" << levels[v] << " ";
+    cout << endl;
+    remove("graph.csr");
+
+    // Directed edges 0 -> i -> K + i: every vertex is reachable from 0 along
+    // out-edges only, so parallel BFS must reach as many vertices as bfs()
+    const int K = 50000;
+    vector<pair<int, int>> directedEdges;
+    for (int i = 1; i <= K; i++) {
+        directedEdges.push_back({0, i});
+        directedEdges.push_back({i, K + i});
+    }
+    CSRGraph directedGraph = CSRGraph::fromEdges(2 * K + 1, directedEdges, false);
+    size_t serialReached = 0;
+    directedGraph.bfs(0, [&](int) { serialReached++; });
+    vector<int> directedLevels = directedGraph.parallelBfs(0, 2);
+    size_t parallelReached = count_if(directedLevels.begin(), directedLevels.end(), [](int d) { return d >= 0; });
+    cout << "Directed graph reached: bfs " << serialReached << ", parallel BFS " << parallelReached << endl;
+
     // Sorting Demo
     cout << "\n--- Sorting Algorithms ---" << endl;
     vector<int> data1 = {64, 34, 25, 12, 22, 11, 90};
@@ -594,6 +2303,25 @@ int main() {
     for (int x : data2) cout << x << " ";
     cout << endl;
 
+    vector<int> data3 = data1;
+    Sorting::quickSort(data3);
+    cout << "Quick Sort result: ";
+    for (int x : data3) cout << x << " ";
+    cout << endl;
+
+    vector<int> data4 = data1;
+    Sorting::radixSort(data4);
+    cout << "Radix Sort result: ";
+    for (int x : data4) cout << x << " ";
+    cout << endl;
+
+    vector<int> data5 = data1;
+    Sorting::sort(data5, greater<int>());
+    cout << "Descending (auto) result: ";
+    for (int x : data5) cout << x << " ";
+    cout << endl;
+
     cout << "\n=== DSA LIBRARY DEMO COMPLETE ===" << endl;
     return 0;
 }
+#endif
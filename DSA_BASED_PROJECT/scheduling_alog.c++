@@ -2,23 +2,41 @@
 #include <vector>
 #include <climits>
 #include <algorithm>
+#include <queue>
 #include<string>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <memory>
+#include <future>
+#include <stdexcept>
+#include <type_traits>
+#include "containers.h"
 using namespace std;
 
 // ==================== PROCESS STRUCTURE ====================
+// Times are 64-bit: a trace of 100M processes runs the clock far past INT_MAX
 struct Process {
-    int pid;              // Process ID
-    int arrivalTime;      // Arrival Time
-    int burstTime;        // Burst Time (Original)
-    int priority;         // Priority (Lower number = Higher priority)
-    int remainingTime;    // Remaining Time for preemptive algorithms
-    int completionTime;   // Completion Time
-    int turnaroundTime;   // Turnaround Time
-    int waitingTime;      // Waiting Time
-    int responseTime;     // Response Time
-    bool started;         // Has process started execution?
-    
-    Process(int id, int arrival, int burst, int prio = 0) {
+    int pid;                  // Process ID
+    int64_t arrivalTime;      // Arrival Time
+    int64_t burstTime;        // Burst Time (Original)
+    int priority;             // Priority (Lower number = Higher priority)
+    int64_t remainingTime;    // Remaining Time for preemptive algorithms
+    int64_t completionTime;   // Completion Time
+    int64_t turnaroundTime;   // Turnaround Time
+    int64_t waitingTime;      // Waiting Time
+    int64_t responseTime;     // Response Time
+    bool started;             // Has process started execution?
+    
+    Process() : Process(0, 0, 0) {}
+    
+    Process(int id, int64_t arrival, int64_t burst, int prio = 0) {
         pid = id;
         arrivalTime = arrival;
         burstTime = burst;
@@ -35,83 +53,414 @@ struct Process {
 // ==================== GANTT CHART ENTRY ====================
 struct GanttEntry {
     int pid;
-    int startTime;
-    int endTime;
+    int64_t startTime;
+    int64_t endTime;
     
-    GanttEntry(int id, int start, int end) : pid(id), startTime(start), endTime(end) {}
+    GanttEntry() : pid(0), startTime(0), endTime(0) {}
+    GanttEntry(int id, int64_t start, int64_t end) : pid(id), startTime(start), endTime(end) {}
+};
+
+// ==================== TRACE FILE I/O ====================
+// Fixed-size binary records streamed through a small buffer, so a trace with
+// millions of processes never has to be resident in memory at once.
+struct TraceRecord {
+    int32_t pid;
+    int32_t priority;
+    int64_t arrivalTime;
+    int64_t burstTime;
 };
 
-// ==================== QUEUE IMPLEMENTATION ====================
 template<typename T>
-class Queue {
+class RecordReader {
 private:
-    struct Node {
-        T data;
-        Node* next;
-        Node(T val) : data(val), next(nullptr) {}
-    };
-    Node* front;
-    Node* rear;
-    int size;
+    FILE* file;
+    vector<T> buffer;
+    size_t pos;
+    size_t count;
+
+    bool refill() {
+        if (!file) return false;
+        pos = 0;
+        count = fread(buffer.data(), sizeof(T), buffer.size(), file);
+        return count > 0;
+    }
 
 public:
-    Queue() : front(nullptr), rear(nullptr), size(0) {}
-    
-    ~Queue() {
-        while (!isEmpty()) {
-            dequeue();
+    RecordReader(const string& path, size_t bufferRecords = 4096)
+        : buffer(bufferRecords), pos(0), count(0) {
+        file = fopen(path.c_str(), "rb");
+        if (!file) {
+            cout << "Cannot open file: " << path << endl;
         }
     }
-    
-    void enqueue(T data) {
-        Node* newNode = new Node(data);
-        if (isEmpty()) {
-            front = rear = newNode;
-        } else {
-            rear->next = newNode;
-            rear = newNode;
+
+    ~RecordReader() {
+        if (file) fclose(file);
+    }
+
+    // Owns the FILE*: a copy would close it twice
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    bool isOpen() {
+        return file != nullptr;
+    }
+
+    bool hasNext() {
+        return pos < count || refill();
+    }
+
+    // Only valid after hasNext() returned true
+    const T& peek() {
+        return buffer[pos];
+    }
+
+    T next() {
+        return buffer[pos++];
+    }
+};
+
+template<typename T>
+class RecordWriter {
+private:
+    FILE* file;
+    vector<T> buffer;
+    size_t capacity;
+    bool failed;
+
+public:
+    RecordWriter(const string& path, size_t bufferRecords = 4096) : capacity(bufferRecords), failed(false) {
+        file = fopen(path.c_str(), "wb");
+        if (!file) {
+            cout << "Cannot open file: " << path << endl;
         }
-        size++;
+        buffer.reserve(capacity);
     }
-    
-    T dequeue() {
-        if (isEmpty()) {
-            cout << "Queue is empty!" << endl;
-            return T();
+
+    ~RecordWriter() {
+        close();
+    }
+
+    // Owns the FILE* and its pending buffer: a copy would write and close twice
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    bool isOpen() {
+        return file != nullptr;
+    }
+
+    // False once any write has failed (e.g. disk full); the file is truncated
+    bool good() {
+        return file != nullptr && !failed;
+    }
+
+    bool write(const T& record) {
+        buffer.push_back(record);
+        if (buffer.size() == capacity) return flush();
+        return !failed;
+    }
+
+    // Returns false on a short write; later writes keep failing
+    bool flush() {
+        if (!file) {
+            failed = true;
+        } else if (!buffer.empty() && fwrite(buffer.data(), sizeof(T), buffer.size(), file) != buffer.size()) {
+            failed = true;
         }
-        Node* temp = front;
-        T data = front->data;
-        front = front->next;
-        if (front == nullptr) rear = nullptr;
-        delete temp;
-        size--;
-        return data;
+        buffer.clear();
+        return !failed;
     }
-    
-    T peek() {
-        if (isEmpty()) return T();
-        return front->data;
+
+    // Flush and close; returns false if anything written was lost
+    bool close() {
+        if (!file) return false;
+        flush();
+        if (fclose(file) != 0) failed = true;
+        file = nullptr;
+        return !failed;
+    }
+};
+
+// Streaming schedulers rely on arrival order: a record that arrives before
+// its predecessor (or has a negative time) ends the trace and is reported
+class TraceReader : public RecordReader<TraceRecord> {
+private:
+    int64_t lastArrival;
+    uint64_t index;
+    bool invalid;
+
+public:
+    TraceReader(const string& path, size_t bufferRecords = 4096)
+        : RecordReader<TraceRecord>(path, bufferRecords), lastArrival(0), index(0), invalid(false) {}
+
+    bool hasNext() {
+        if (invalid || !RecordReader<TraceRecord>::hasNext()) return false;
+        const TraceRecord& record = RecordReader<TraceRecord>::peek();
+        if (record.arrivalTime < lastArrival || record.burstTime < 0) {
+            cout << "Invalid trace record " << index << ": arrival times must not decrease" << endl;
+            invalid = true;
+            return false;
+        }
+        return true;
+    }
+
+    TraceRecord next() {
+        TraceRecord record = RecordReader<TraceRecord>::next();
+        lastArrival = record.arrivalTime;
+        index++;
+        return record;
+    }
+
+    // False if the trace was cut short by an out-of-order record
+    bool isValid() {
+        return !invalid;
+    }
+};
+
+typedef RecordWriter<TraceRecord> TraceWriter;
+typedef RecordWriter<GanttEntry> GanttSpill;
+
+// Write processes as a trace file sorted by arrival time (ties keep input order).
+// Returns false if the file could not be written in full.
+bool writeTrace(const string& path, vector<Process> processes) {
+    stable_sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
+        return a.arrivalTime < b.arrivalTime;
+    });
+    TraceWriter writer(path);
+    for (const auto& p : processes) {
+        if (!writer.write(TraceRecord{p.pid, p.priority, p.arrivalTime, p.burstTime})) break;
+    }
+    return writer.close();
+}
+
+// ==================== STREAMING METRICS ====================
+// Log-linear histogram: exact below 64, then 64 sub-buckets per power of two
+// (relative error under 1.6%). Fixed 3712 buckets whatever the input size.
+class LatencyHistogram {
+private:
+    static const int SUB_BITS = 6;
+    static const int SUB_COUNT = 1 << SUB_BITS;
+    static const int BUCKETS = (63 - SUB_BITS + 1) * SUB_COUNT;
+    vector<uint64_t> counts;
+    uint64_t total;
+
+    static int bucketOf(int64_t value) {
+        if (value < SUB_COUNT) return value < 0 ? 0 : (int)value;
+        int exponent = 63 - __builtin_clzll((uint64_t)value);
+        int shift = exponent - SUB_BITS;
+        return (shift + 1) * SUB_COUNT + (int)((value >> shift) - SUB_COUNT);
+    }
+
+    static int64_t bucketUpperBound(int index) {
+        if (index < SUB_COUNT) return index;
+        int shift = index / SUB_COUNT - 1;
+        int64_t mantissa = SUB_COUNT + index % SUB_COUNT;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+public:
+    LatencyHistogram() : counts(BUCKETS, 0), total(0) {}
+
+    void record(int64_t value) {
+        counts[bucketOf(value)]++;
+        total++;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (int i = 0; i < BUCKETS; i++) counts[i] += other.counts[i];
+        total += other.total;
+    }
+
+    // Smallest bucket bound covering the given fraction of samples
+    int64_t percentile(double fraction) const {
+        if (total == 0) return 0;
+        uint64_t rank = (uint64_t)ceil(fraction * total);
+        if (rank < 1) rank = 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            seen += counts[i];
+            if (seen >= rank) return bucketUpperBound(i);
+        }
+        return bucketUpperBound(BUCKETS - 1);
+    }
+};
+
+class StreamingStats {
+private:
+    uint64_t count;
+    double totalTurnaround, totalWaiting, totalResponse;
+    LatencyHistogram turnaround, waiting, response;
+
+public:
+    StreamingStats() : count(0), totalTurnaround(0), totalWaiting(0), totalResponse(0) {}
+
+    void record(const Process& p) {
+        record(p.turnaroundTime, p.waitingTime, (p.responseTime != -1) ? p.responseTime : 0);
+    }
+
+    void record(int64_t turnaroundTime, int64_t waitingTime, int64_t responseTime) {
+        count++;
+        totalTurnaround += turnaroundTime;
+        totalWaiting += waitingTime;
+        totalResponse += responseTime;
+        turnaround.record(turnaroundTime);
+        waiting.record(waitingTime);
+        response.record(responseTime);
+    }
+
+    void merge(const StreamingStats& other) {
+        count += other.count;
+        totalTurnaround += other.totalTurnaround;
+        totalWaiting += other.totalWaiting;
+        totalResponse += other.totalResponse;
+        turnaround.merge(other.turnaround);
+        waiting.merge(other.waiting);
+        response.merge(other.response);
+    }
+
+    uint64_t processed() const {
+        return count;
+    }
+
+    const LatencyHistogram& responseHistogram() const {
+        return response;
+    }
+
+    void display(const string& algorithmName) {
+        cout << "\n=== " << algorithmName << " STREAMING RESULTS ===" << endl;
+        cout << "Processes: " << count << endl;
+        if (count == 0) return;
+
+        cout << "\nMetric\t\tAverage\tp50\tp99\tp99.9" << endl;
+        cout << "--------------------------------------------------" << endl;
+        displayRow("Turnaround", totalTurnaround, turnaround);
+        displayRow("Waiting\t", totalWaiting, waiting);
+        displayRow("Response", totalResponse, response);
+    }
+
+private:
+    void displayRow(const string& name, double total, const LatencyHistogram& histogram) {
+        cout << name << "\t" << total / count << "\t" << histogram.percentile(0.50) << "\t"
+             << histogram.percentile(0.99) << "\t" << histogram.percentile(0.999) << endl;
     }
+};
+// ==================== SCHEDULER CONFIGURATION ====================
+// Queue boundaries and interactive quantum for multilevel queue scheduling
+struct MultilevelConfig {
+    int systemMaxPriority;       // Priority <= this goes to the system queue
+    int interactiveMaxPriority;  // Priority <= this goes to the interactive queue, rest to batch
+    int interactiveQuantum;      // Round Robin time quantum of the interactive queue
+    
+    MultilevelConfig(int systemMax = 1, int interactiveMax = 3, int quantum = 2)
+        : systemMaxPriority(systemMax), interactiveMaxPriority(interactiveMax), interactiveQuantum(quantum) {}
+};
+
+enum class Algorithm {
+    FCFS,
+    SJF,
+    SRTF,
+    PRIORITY_NON_PREEMPTIVE,
+    PRIORITY_PREEMPTIVE,
+    ROUND_ROBIN,
+    MULTILEVEL_QUEUE
+};
+
+// One point of a what-if sweep
+struct SchedulerConfig {
+    Algorithm algorithm;
+    int timeQuantum;              // Used by ROUND_ROBIN only
+    MultilevelConfig multilevel;  // Used by MULTILEVEL_QUEUE only
+    
+    SchedulerConfig(Algorithm algo, int quantum = 2, MultilevelConfig mlq = MultilevelConfig())
+        : algorithm(algo), timeQuantum(quantum), multilevel(mlq) {}
     
-    bool isEmpty() {
-        return front == nullptr;
+    string name() const {
+        switch (algorithm) {
+            case Algorithm::FCFS: return "FCFS";
+            case Algorithm::SJF: return "SJF";
+            case Algorithm::SRTF: return "SRTF";
+            case Algorithm::PRIORITY_NON_PREEMPTIVE: return "Priority (NP)";
+            case Algorithm::PRIORITY_PREEMPTIVE: return "Priority (P)";
+            case Algorithm::ROUND_ROBIN: return "RR q=" + to_string(timeQuantum);
+            case Algorithm::MULTILEVEL_QUEUE:
+                return "MLQ " + to_string(multilevel.systemMaxPriority) + "/" +
+                       to_string(multilevel.interactiveMaxPriority) + " q=" +
+                       to_string(multilevel.interactiveQuantum);
+        }
+        return "";
     }
     
-    int getSize() {
-        return size;
+    // A quantum below 1 would never advance the clock; clamp like the dispatcher
+    SchedulerConfig clamped() const {
+        SchedulerConfig config = *this;
+        config.timeQuantum = max(1, timeQuantum);
+        config.multilevel.interactiveQuantum = max(1, multilevel.interactiveQuantum);
+        return config;
     }
 };
+
+struct SweepResult {
+    SchedulerConfig config;
+    double avgTurnaround;
+    double avgWaiting;
+    double avgResponse;
+    int64_t makespan;  // Completion time of the last process
+    int dispatches;    // Number of Gantt chart entries
+    
+    SweepResult() : config(Algorithm::FCFS), avgTurnaround(0), avgWaiting(0), avgResponse(0),
+                    makespan(0), dispatches(0) {}
+};
+
 // ==================== CPU SCHEDULER CLASS ====================
 class CPUScheduler {
 private:
     vector<Process> originalProcesses;
     vector<GanttEntry> ganttChart;
     
-    void calculateMetrics(vector<Process>& processes) {
+    static void calculateMetrics(Process& p) {
+        p.turnaroundTime = p.completionTime - p.arrivalTime;
+        p.waitingTime = p.turnaroundTime - p.burstTime;
+    }
+    
+    static void calculateMetrics(vector<Process>& processes) {
         for (auto& p : processes) {
-            p.turnaroundTime = p.completionTime - p.arrivalTime;
-            p.waitingTime = p.turnaroundTime - p.burstTime;
+            calculateMetrics(p);
+        }
+    }
+    
+    // Streaming runs keep no per-process history: finished processes are
+    // folded into the running statistics and Gantt entries go to the spill file
+    void finishStreamed(Process& p, StreamingStats& stats) {
+        calculateMetrics(p);
+        stats.record(p);
+    }
+    
+    void spillGantt(GanttSpill* gantt, int pid, int64_t start, int64_t end) {
+        if (gantt) gantt->write(GanttEntry(pid, start, end));
+    }
+    
+    static Process fromRecord(const TraceRecord& r) {
+        return Process(r.pid, r.arrivalTime, r.burstTime, r.priority);
+    }
+    
+    static SweepResult summarize(const SchedulerConfig& config, const vector<Process>& processes,
+                                 const vector<GanttEntry>& gantt) {
+        SweepResult result;
+        result.config = config;
+        result.dispatches = gantt.size();
+        for (const auto& p : processes) {
+            result.avgTurnaround += p.turnaroundTime;
+            result.avgWaiting += p.waitingTime;
+            result.avgResponse += (p.responseTime != -1) ? p.responseTime : 0;
+            result.makespan = max(result.makespan, p.completionTime);
+        }
+        int n = processes.size();
+        if (n > 0) {
+            result.avgTurnaround /= n;
+            result.avgWaiting /= n;
+            result.avgResponse /= n;
         }
+        return result;
     }
     
     void displayResults(const vector<Process>& processes, const string& algorithmName) {
@@ -155,288 +504,161 @@ private:
         cout << endl;
     }
 
-public:
-    CPUScheduler(const vector<Process>& processes) : originalProcesses(processes) {}
-    
-    // ==================== FIRST COME FIRST SERVE (FCFS) ====================
-    void fcfs() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
-        // Sort by arrival time
-        sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
-            return a.arrivalTime < b.arrivalTime;
+    // ==================== EVENT-DRIVEN SIMULATION CORE ====================
+    // Shared engine for SJF, SRTF and both Priority variants. Arrivals are
+    // sorted once and the ready set is a min-heap keyed by (key, index), so the
+    // lowest index wins ties exactly like the old linear scan did. Instead of
+    // ticking one unit at a time, time jumps straight to the next arrival or
+    // completion: O(n log n) regardless of burst lengths.
+    template<typename KeyFn>
+    static void simulateEvents(vector<Process>& processes, vector<GanttEntry>& gantt,
+                               KeyFn key, bool preemptive) {
+        int n = processes.size();
+        vector<int> arrivalOrder(n);
+        for (int i = 0; i < n; i++) arrivalOrder[i] = i;
+        stable_sort(arrivalOrder.begin(), arrivalOrder.end(), [&](int a, int b) {
+            return processes[a].arrivalTime < processes[b].arrivalTime;
         });
         
-        int currentTime = 0;
-        
-        for (auto& process : processes) {
-            if (currentTime < process.arrivalTime) {
-                currentTime = process.arrivalTime;
-            }
-            
-            process.responseTime = currentTime - process.arrivalTime;
-            process.completionTime = currentTime + process.burstTime;
-            currentTime = process.completionTime;
-            
-            ganttChart.push_back(GanttEntry(process.pid, currentTime - process.burstTime, currentTime));
-        }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "FIRST COME FIRST SERVE (FCFS)");
-    }
-    
-    // ==================== SHORTEST JOB FIRST (NON-PREEMPTIVE) ====================
-    void sjfNonPreemptive() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
-        int currentTime = 0;
+        priority_queue<pair<int64_t, int>, vector<pair<int64_t, int>>, greater<pair<int64_t, int>>> readySet;
+        int64_t currentTime = 0;
         int completed = 0;
-        int n = processes.size();
-        vector<bool> isCompleted(n, false);
+        int nextArrival = 0;
+        int lastExecuted = -1;
         
-        while (completed < n) {
-            int shortestJob = -1;
-            int minBurst = INT_MAX;
-            
-            // Find shortest job among arrived processes
-            for (int i = 0; i < n; i++) {
-                if (!isCompleted[i] && processes[i].arrivalTime <= currentTime) {
-                    if (processes[i].burstTime < minBurst) {
-                        minBurst = processes[i].burstTime;
-                        shortestJob = i;
-                    }
+        // Move every process that has arrived by currentTime into the ready set
+        auto admitArrivals = [&]() {
+            while (nextArrival < n && processes[arrivalOrder[nextArrival]].arrivalTime <= currentTime) {
+                int i = arrivalOrder[nextArrival++];
+                if (!preemptive || processes[i].remainingTime > 0) {
+                    readySet.push({key(processes[i]), i});
                 }
             }
-            
-            if (shortestJob == -1) {
-                currentTime++;
-                continue;
-            }
-            
-            Process& p = processes[shortestJob];
-            p.responseTime = currentTime - p.arrivalTime;
-            p.completionTime = currentTime + p.burstTime;
-            currentTime = p.completionTime;
-            isCompleted[shortestJob] = true;
-            completed++;
-            
-            ganttChart.push_back(GanttEntry(p.pid, currentTime - p.burstTime, currentTime));
-        }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "SHORTEST JOB FIRST (NON-PREEMPTIVE)");
-    }
-    
-    // ==================== SHORTEST REMAINING TIME FIRST (PREEMPTIVE SJF) ====================
-    void srtf() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
-        int currentTime = 0;
-        int completed = 0;
-        int n = processes.size();
-        int lastExecuted = -1;
+        };
         
         while (completed < n) {
-            int shortestRemaining = -1;
-            int minRemaining = INT_MAX;
+            admitArrivals();
             
-            // Find process with shortest remaining time
-            for (int i = 0; i < n; i++) {
-                if (processes[i].arrivalTime <= currentTime && processes[i].remainingTime > 0) {
-                    if (processes[i].remainingTime < minRemaining) {
-                        minRemaining = processes[i].remainingTime;
-                        shortestRemaining = i;
-                    }
-                }
+            // CPU idle: skip the gap and jump to the next arrival
+            if (readySet.empty()) {
+                if (nextArrival == n) break;
+                currentTime = processes[arrivalOrder[nextArrival]].arrivalTime;
+                continue;
             }
             
-            if (shortestRemaining == -1) {
-                currentTime++;
+            int current = readySet.top().second;
+            readySet.pop();
+            Process& p = processes[current];
+            
+            if (!preemptive) {
+                p.responseTime = currentTime - p.arrivalTime;
+                p.completionTime = currentTime + p.burstTime;
+                currentTime = p.completionTime;
+                completed++;
+                
+                gantt.push_back(GanttEntry(p.pid, currentTime - p.burstTime, currentTime));
                 continue;
             }
             
-            Process& p = processes[shortestRemaining];
-            
-            // Set response time if process starts for first time
             if (!p.started) {
                 p.responseTime = currentTime - p.arrivalTime;
                 p.started = true;
             }
             
-            // Add to Gantt chart if different process or first entry
-            if (lastExecuted != shortestRemaining) {
-                if (!ganttChart.empty() && ganttChart.back().pid != -1) {
-                    ganttChart.back().endTime = currentTime;
+            if (lastExecuted != current) {
+                if (!gantt.empty() && gantt.back().pid != -1) {
+                    gantt.back().endTime = currentTime;
                 }
-                ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + 1));
+                gantt.push_back(GanttEntry(p.pid, currentTime, currentTime + 1));
             }
             
-            p.remainingTime--;
-            currentTime++;
-            lastExecuted = shortestRemaining;
+            // The selected process stays on top of the ready set until it
+            // finishes or the next arrival can preempt it
+            int64_t runUntil = currentTime + p.remainingTime;
+            if (nextArrival < n) {
+                runUntil = min(runUntil, processes[arrivalOrder[nextArrival]].arrivalTime);
+            }
+            p.remainingTime -= runUntil - currentTime;
+            currentTime = runUntil;
+            lastExecuted = current;
             
             if (p.remainingTime == 0) {
                 p.completionTime = currentTime;
                 completed++;
-                if (!ganttChart.empty()) {
-                    ganttChart.back().endTime = currentTime;
+                if (!gantt.empty()) {
+                    gantt.back().endTime = currentTime;
                 }
+            } else {
+                readySet.push({key(p), current});
             }
         }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "SHORTEST REMAINING TIME FIRST (SRTF)");
     }
-    
-    // ==================== PRIORITY SCHEDULING (NON-PREEMPTIVE) ====================
-    void priorityNonPreemptive() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
+
+    // ==================== ALGORITHM CORES ====================
+    // Pure simulations: they only touch the process copy and Gantt buffer they
+    // are given, so different configurations can run on different threads.
+    static void runFcfs(vector<Process>& processes, vector<GanttEntry>& gantt) {
+        // Sort by arrival time (ties keep input order)
+        stable_sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
+            return a.arrivalTime < b.arrivalTime;
+        });
         
-        int currentTime = 0;
-        int completed = 0;
-        int n = processes.size();
-        vector<bool> isCompleted(n, false);
+        int64_t currentTime = 0;
         
-        while (completed < n) {
-            int highestPriority = -1;
-            int minPriority = INT_MAX;
-            
-            // Find highest priority process (lower number = higher priority)
-            for (int i = 0; i < n; i++) {
-                if (!isCompleted[i] && processes[i].arrivalTime <= currentTime) {
-                    if (processes[i].priority < minPriority) {
-                        minPriority = processes[i].priority;
-                        highestPriority = i;
-                    }
-                }
-            }
-            
-            if (highestPriority == -1) {
-                currentTime++;
-                continue;
+        for (auto& process : processes) {
+            if (currentTime < process.arrivalTime) {
+                currentTime = process.arrivalTime;
             }
             
-            Process& p = processes[highestPriority];
-            p.responseTime = currentTime - p.arrivalTime;
-            p.completionTime = currentTime + p.burstTime;
-            currentTime = p.completionTime;
-            isCompleted[highestPriority] = true;
-            completed++;
+            process.responseTime = currentTime - process.arrivalTime;
+            process.completionTime = currentTime + process.burstTime;
+            currentTime = process.completionTime;
             
-            ganttChart.push_back(GanttEntry(p.pid, currentTime - p.burstTime, currentTime));
+            gantt.push_back(GanttEntry(process.pid, currentTime - process.burstTime, currentTime));
         }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "PRIORITY SCHEDULING (NON-PREEMPTIVE)");
     }
-    
-    // ==================== PRIORITY SCHEDULING (PREEMPTIVE) ====================
-    void priorityPreemptive() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
-        int currentTime = 0;
+
+    static void runRoundRobin(vector<Process>& processes, vector<GanttEntry>& gantt, int timeQuantum) {
+        Queue<int> readyQueue;
+        int64_t currentTime = 0;
         int completed = 0;
         int n = processes.size();
-        int lastExecuted = -1;
+        vector<bool> inQueue(n, false);
         
-        while (completed < n) {
-            int highestPriority = -1;
-            int minPriority = INT_MAX;
-            
-            // Find highest priority process
-            for (int i = 0; i < n; i++) {
-                if (processes[i].arrivalTime <= currentTime && processes[i].remainingTime > 0) {
-                    if (processes[i].priority < minPriority) {
-                        minPriority = processes[i].priority;
-                        highestPriority = i;
-                    }
-                }
+        // Add initial processes to ready queue
+        for (int i = 0; i < n; i++) {
+            if (processes[i].arrivalTime <= currentTime) {
+                readyQueue.enqueue(i);
+                inQueue[i] = true;
             }
-            
-            if (highestPriority == -1) {
+        }
+        
+        while (completed < n || !readyQueue.isEmpty()) {
+            if (readyQueue.isEmpty()) {
                 currentTime++;
+                // Add newly arrived processes
+                for (int i = 0; i < n; i++) {
+                    if (!inQueue[i] && processes[i].arrivalTime <= currentTime && processes[i].remainingTime > 0) {
+                        readyQueue.enqueue(i);
+                        inQueue[i] = true;
+                    }
+                }
                 continue;
             }
             
-            Process& p = processes[highestPriority];
+            int current;
+            
+            readyQueue.dequeue(current);
+            inQueue[current] = false;
+            Process& p = processes[current];
             
             if (!p.started) {
                 p.responseTime = currentTime - p.arrivalTime;
                 p.started = true;
             }
             
-            if (lastExecuted != highestPriority) {
-                if (!ganttChart.empty() && ganttChart.back().pid != -1) {
-                    ganttChart.back().endTime = currentTime;
-                }
-                ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + 1));
-            }
-            
-            p.remainingTime--;
-            currentTime++;
-            lastExecuted = highestPriority;
-            
-            if (p.remainingTime == 0) {
-                p.completionTime = currentTime;
-                completed++;
-                if (!ganttChart.empty()) {
-                    ganttChart.back().endTime = currentTime;
-                }
-            }
-        }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "PRIORITY SCHEDULING (PREEMPTIVE)");
-    }
-    
-    // ==================== ROUND ROBIN ====================
-    void roundRobin(int timeQuantum) {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
-        Queue<int> readyQueue;
-        int currentTime = 0;
-        int completed = 0;
-        int n = processes.size();
-        vector<bool> inQueue(n, false);
-        
-        // Add initial processes to ready queue
-        for (int i = 0; i < n; i++) {
-            if (processes[i].arrivalTime <= currentTime) {
-                readyQueue.enqueue(i);
-                inQueue[i] = true;
-            }
-        }
-        
-        while (completed < n || !readyQueue.isEmpty()) {
-            if (readyQueue.isEmpty()) {
-                currentTime++;
-                // Add newly arrived processes
-                for (int i = 0; i < n; i++) {
-                    if (!inQueue[i] && processes[i].arrivalTime <= currentTime && processes[i].remainingTime > 0) {
-                        readyQueue.enqueue(i);
-                        inQueue[i] = true;
-                    }
-                }
-                continue;
-            }
-            
-            int current = readyQueue.dequeue();
-            inQueue[current] = false;
-            Process& p = processes[current];
-            
-            if (!p.started) {
-                p.responseTime = currentTime - p.arrivalTime;
-                p.started = true;
-            }
-            
-            int executeTime = min(timeQuantum, p.remainingTime);
-            ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + executeTime));
+            int64_t executeTime = min<int64_t>(max(1, timeQuantum), p.remainingTime);
+            gantt.push_back(GanttEntry(p.pid, currentTime, currentTime + executeTime));
             
             p.remainingTime -= executeTime;
             currentTime += executeTime;
@@ -458,22 +680,16 @@ public:
                 inQueue[current] = true;
             }
         }
-        
-        calculateMetrics(processes);
-        displayResults(processes, "ROUND ROBIN (Time Quantum: " + to_string(timeQuantum) + ")");
     }
-    
-    // ==================== MULTILEVEL QUEUE SCHEDULING ====================
-    void multilevelQueue() {
-        vector<Process> processes = originalProcesses;
-        ganttChart.clear();
-        
+
+    static void runMultilevel(vector<Process>& processes, vector<GanttEntry>& gantt,
+                              const MultilevelConfig& config) {
         // Separate processes into different queues based on priority
-        Queue<int> systemQueue;      // Priority 0-1
-        Queue<int> interactiveQueue; // Priority 2-3
-        Queue<int> batchQueue;       // Priority 4-5
+        Queue<int> systemQueue;      // Priority 0-1 by default
+        Queue<int> interactiveQueue; // Priority 2-3 by default
+        Queue<int> batchQueue;       // Priority 4-5 by default
         
-        int currentTime = 0;
+        int64_t currentTime = 0;
         int completed = 0;
         int n = processes.size();
         vector<bool> inQueue(n, false);
@@ -481,9 +697,9 @@ public:
         auto addToQueues = [&]() {
             for (int i = 0; i < n; i++) {
                 if (!inQueue[i] && processes[i].arrivalTime <= currentTime && processes[i].remainingTime > 0) {
-                    if (processes[i].priority <= 1) {
+                    if (processes[i].priority <= config.systemMaxPriority) {
                         systemQueue.enqueue(i);
-                    } else if (processes[i].priority <= 3) {
+                    } else if (processes[i].priority <= config.interactiveMaxPriority) {
                         interactiveQueue.enqueue(i);
                     } else {
                         batchQueue.enqueue(i);
@@ -500,7 +716,8 @@ public:
             
             // System queue (highest priority) - FCFS
             if (!systemQueue.isEmpty()) {
-                int current = systemQueue.dequeue();
+                int current;
+                systemQueue.dequeue(current);
                 inQueue[current] = false;
                 Process& p = processes[current];
                 
@@ -509,16 +726,17 @@ public:
                     p.started = true;
                 }
                 
-                ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + p.remainingTime));
+                gantt.push_back(GanttEntry(p.pid, currentTime, currentTime + p.remainingTime));
                 currentTime += p.remainingTime;
                 p.remainingTime = 0;
                 p.completionTime = currentTime;
                 completed++;
                 executed = true;
             }
-            // Interactive queue - Round Robin with quantum 2
+            // Interactive queue - Round Robin
             else if (!interactiveQueue.isEmpty()) {
-                int current = interactiveQueue.dequeue();
+                int current;
+                interactiveQueue.dequeue(current);
                 inQueue[current] = false;
                 Process& p = processes[current];
                 
@@ -527,8 +745,8 @@ public:
                     p.started = true;
                 }
                 
-                int executeTime = min(2, p.remainingTime);
-                ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + executeTime));
+                int64_t executeTime = min<int64_t>(max(1, config.interactiveQuantum), p.remainingTime);
+                gantt.push_back(GanttEntry(p.pid, currentTime, currentTime + executeTime));
                 p.remainingTime -= executeTime;
                 currentTime += executeTime;
                 
@@ -543,7 +761,8 @@ public:
             }
             // Batch queue - FCFS
             else if (!batchQueue.isEmpty()) {
-                int current = batchQueue.dequeue();
+                int current;
+                batchQueue.dequeue(current);
                 inQueue[current] = false;
                 Process& p = processes[current];
                 
@@ -552,7 +771,7 @@ public:
                     p.started = true;
                 }
                 
-                ganttChart.push_back(GanttEntry(p.pid, currentTime, currentTime + p.remainingTime));
+                gantt.push_back(GanttEntry(p.pid, currentTime, currentTime + p.remainingTime));
                 currentTime += p.remainingTime;
                 p.remainingTime = 0;
                 p.completionTime = currentTime;
@@ -566,13 +785,840 @@ public:
             
             addToQueues();
         }
+    }
+
+    // Run one configuration on a private copy of the workload
+    static void runAlgorithm(const SchedulerConfig& config, vector<Process>& processes,
+                             vector<GanttEntry>& gantt) {
+        switch (config.algorithm) {
+            case Algorithm::FCFS:
+                runFcfs(processes, gantt);
+                break;
+            case Algorithm::SJF:
+                simulateEvents(processes, gantt, [](const Process& p) { return p.burstTime; }, false);
+                break;
+            case Algorithm::SRTF:
+                simulateEvents(processes, gantt, [](const Process& p) { return p.remainingTime; }, true);
+                break;
+            case Algorithm::PRIORITY_NON_PREEMPTIVE:
+                simulateEvents(processes, gantt, [](const Process& p) { return p.priority; }, false);
+                break;
+            case Algorithm::PRIORITY_PREEMPTIVE:
+                simulateEvents(processes, gantt, [](const Process& p) { return p.priority; }, true);
+                break;
+            case Algorithm::ROUND_ROBIN:
+                runRoundRobin(processes, gantt, config.timeQuantum);
+                break;
+            case Algorithm::MULTILEVEL_QUEUE:
+                runMultilevel(processes, gantt, config.multilevel);
+                break;
+        }
+    }
+
+public:
+    CPUScheduler() {}
+    CPUScheduler(const vector<Process>& processes) : originalProcesses(processes) {}
+    
+    // ==================== FIRST COME FIRST SERVE (FCFS) ====================
+    void fcfs() {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        runFcfs(processes, ganttChart);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "FIRST COME FIRST SERVE (FCFS)");
+    }
+    
+    // ==================== SHORTEST JOB FIRST (NON-PREEMPTIVE) ====================
+    void sjfNonPreemptive() {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        simulateEvents(processes, ganttChart, [](const Process& p) { return p.burstTime; }, false);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "SHORTEST JOB FIRST (NON-PREEMPTIVE)");
+    }
+    
+    // ==================== SHORTEST REMAINING TIME FIRST (PREEMPTIVE SJF) ====================
+    void srtf() {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        simulateEvents(processes, ganttChart, [](const Process& p) { return p.remainingTime; }, true);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "SHORTEST REMAINING TIME FIRST (SRTF)");
+    }
+    
+    // ==================== PRIORITY SCHEDULING (NON-PREEMPTIVE) ====================
+    void priorityNonPreemptive() {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        simulateEvents(processes, ganttChart, [](const Process& p) { return p.priority; }, false);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "PRIORITY SCHEDULING (NON-PREEMPTIVE)");
+    }
+    
+    // ==================== PRIORITY SCHEDULING (PREEMPTIVE) ====================
+    void priorityPreemptive() {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        simulateEvents(processes, ganttChart, [](const Process& p) { return p.priority; }, true);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "PRIORITY SCHEDULING (PREEMPTIVE)");
+    }
+    
+    // ==================== ROUND ROBIN ====================
+    void roundRobin(int timeQuantum) {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        runRoundRobin(processes, ganttChart, timeQuantum);
+        
+        calculateMetrics(processes);
+        displayResults(processes, "ROUND ROBIN (Time Quantum: " + to_string(timeQuantum) + ")");
+    }
+    
+    // ==================== MULTILEVEL QUEUE SCHEDULING ====================
+    void multilevelQueue(const MultilevelConfig& config = MultilevelConfig()) {
+        vector<Process> processes = originalProcesses;
+        ganttChart.clear();
+        
+        runMultilevel(processes, ganttChart, config);
         
         calculateMetrics(processes);
         displayResults(processes, "MULTILEVEL QUEUE SCHEDULING");
     }
+    
+    // ==================== WHAT-IF SWEEP ====================
+    // Runs every configuration of the grid against the shared, read-only
+    // workload on a pool of worker threads. Workers pull task indices from an
+    // atomic counter and reuse their own process/Gantt buffers, and each task
+    // writes only its own result slot, so no locking is needed. Quanta below 1
+    // are clamped to 1 up front, and results report the clamped configuration.
+    vector<SweepResult> sweep(const vector<SchedulerConfig>& requested, int threadCount = 0) const {
+        vector<SweepResult> results(requested.size());
+        if (requested.empty()) return results;
+        
+        vector<SchedulerConfig> grid;
+        grid.reserve(requested.size());
+        for (const auto& config : requested) {
+            grid.push_back(config.clamped());
+        }
+        
+        if (threadCount <= 0) {
+            threadCount = max(1u, thread::hardware_concurrency());
+        }
+        threadCount = min<int>(threadCount, grid.size());
+        
+        atomic<size_t> nextTask(0);
+        auto worker = [&]() {
+            vector<Process> processes;
+            vector<GanttEntry> gantt;
+            for (size_t t = nextTask++; t < grid.size(); t = nextTask++) {
+                processes.assign(originalProcesses.begin(), originalProcesses.end());
+                gantt.clear();
+                
+                runAlgorithm(grid[t], processes, gantt);
+                calculateMetrics(processes);
+                results[t] = summarize(grid[t], processes, gantt);
+            }
+        };
+        
+        vector<thread> pool;
+        for (int i = 1; i < threadCount; i++) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& th : pool) {
+            th.join();
+        }
+        return results;
+    }
+    
+    static void displaySweep(const vector<SweepResult>& results) {
+        cout << "\n=== WHAT-IF SWEEP RESULTS ===" << endl;
+        cout << "Configuration\tAvg TAT\tAvg WT\tAvg RT\tMakespan\tDispatches" << endl;
+        cout << "----------------------------------------------------------------------" << endl;
+        for (const auto& r : results) {
+            string name = r.config.name();
+            cout << name << (name.size() < 8 ? "\t\t" : "\t") << r.avgTurnaround << "\t"
+                 << r.avgWaiting << "\t" << r.avgResponse << "\t" << r.makespan << "\t\t"
+                 << r.dispatches << endl;
+        }
+    }
+    
+    // ==================== STREAMING MODE ====================
+    // Same policies as fcfs(), roundRobin() and multilevelQueue(), but fed from
+    // a trace sorted by arrival time. Memory is bounded by the processes that
+    // are in the system at once, and only summary statistics are printed.
+    void fcfs(TraceReader& trace, GanttSpill* gantt = nullptr) {
+        StreamingStats stats;
+        int64_t currentTime = 0;
+        
+        while (trace.hasNext()) {
+            Process process = fromRecord(trace.next());
+            if (currentTime < process.arrivalTime) {
+                currentTime = process.arrivalTime;
+            }
+            
+            process.responseTime = currentTime - process.arrivalTime;
+            process.completionTime = currentTime + process.burstTime;
+            currentTime = process.completionTime;
+            
+            spillGantt(gantt, process.pid, currentTime - process.burstTime, currentTime);
+            finishStreamed(process, stats);
+        }
+        
+        stats.display("FIRST COME FIRST SERVE (FCFS)");
+    }
+    
+    void roundRobin(TraceReader& trace, int timeQuantum, GanttSpill* gantt = nullptr) {
+        StreamingStats stats;
+        Queue<Process> readyQueue;
+        int64_t currentTime = 0;
+        
+        auto admitArrivals = [&]() {
+            while (trace.hasNext() && trace.peek().arrivalTime <= currentTime) {
+                readyQueue.enqueue(fromRecord(trace.next()));
+            }
+        };
+        
+        admitArrivals();
+        
+        while (!readyQueue.isEmpty() || trace.hasNext()) {
+            if (readyQueue.isEmpty()) {
+                currentTime = trace.peek().arrivalTime;
+                admitArrivals();
+                continue;
+            }
+            
+            Process p;
+            
+            readyQueue.dequeue(p);
+            
+            if (!p.started) {
+                p.responseTime = currentTime - p.arrivalTime;
+                p.started = true;
+            }
+            
+            int64_t executeTime = min<int64_t>(max(1, timeQuantum), p.remainingTime);
+            spillGantt(gantt, p.pid, currentTime, currentTime + executeTime);
+            
+            p.remainingTime -= executeTime;
+            currentTime += executeTime;
+            
+            // Newly arrived processes queue ahead of the preempted one
+            admitArrivals();
+            
+            if (p.remainingTime == 0) {
+                p.completionTime = currentTime;
+                finishStreamed(p, stats);
+            } else {
+                readyQueue.enqueue(p);
+            }
+        }
+        
+        stats.display("ROUND ROBIN (Time Quantum: " + to_string(timeQuantum) + ")");
+    }
+    
+    void multilevelQueue(TraceReader& trace, GanttSpill* gantt = nullptr,
+                         const MultilevelConfig& config = MultilevelConfig()) {
+        StreamingStats stats;
+        Queue<Process> systemQueue;      // Priority 0-1 by default
+        Queue<Process> interactiveQueue; // Priority 2-3 by default
+        Queue<Process> batchQueue;       // Priority 4-5 by default
+        int64_t currentTime = 0;
+        
+        auto addToQueues = [&]() {
+            while (trace.hasNext() && trace.peek().arrivalTime <= currentTime) {
+                Process p = fromRecord(trace.next());
+                if (p.priority <= config.systemMaxPriority) {
+                    systemQueue.enqueue(p);
+                } else if (p.priority <= config.interactiveMaxPriority) {
+                    interactiveQueue.enqueue(p);
+                } else {
+                    batchQueue.enqueue(p);
+                }
+            }
+        };
+        
+        // Run a process from the system or batch queue to completion
+        auto runToCompletion = [&](Queue<Process>& queue) {
+            Process p;
+            queue.dequeue(p);
+            if (!p.started) {
+                p.responseTime = currentTime - p.arrivalTime;
+                p.started = true;
+            }
+            spillGantt(gantt, p.pid, currentTime, currentTime + p.remainingTime);
+            currentTime += p.remainingTime;
+            p.remainingTime = 0;
+            p.completionTime = currentTime;
+            finishStreamed(p, stats);
+        };
+        
+        addToQueues();
+        
+        while (!systemQueue.isEmpty() || !interactiveQueue.isEmpty() ||
+               !batchQueue.isEmpty() || trace.hasNext()) {
+            // System queue (highest priority) - FCFS
+            if (!systemQueue.isEmpty()) {
+                runToCompletion(systemQueue);
+            }
+            // Interactive queue - Round Robin
+            else if (!interactiveQueue.isEmpty()) {
+                Process p;
+                interactiveQueue.dequeue(p);
+                
+                if (!p.started) {
+                    p.responseTime = currentTime - p.arrivalTime;
+                    p.started = true;
+                }
+                
+                int64_t executeTime = min<int64_t>(max(1, config.interactiveQuantum), p.remainingTime);
+                spillGantt(gantt, p.pid, currentTime, currentTime + executeTime);
+                p.remainingTime -= executeTime;
+                currentTime += executeTime;
+                
+                if (p.remainingTime == 0) {
+                    p.completionTime = currentTime;
+                    finishStreamed(p, stats);
+                } else {
+                    interactiveQueue.enqueue(p);
+                }
+            }
+            // Batch queue - FCFS
+            else if (!batchQueue.isEmpty()) {
+                runToCompletion(batchQueue);
+            }
+            // Idle - jump to the next arrival
+            else {
+                currentTime = trace.peek().arrivalTime;
+            }
+            
+            addToQueues();
+        }
+        
+        stats.display("MULTILEVEL QUEUE SCHEDULING");
+    }
+};
+
+// ==================== ONLINE DISPATCHER ====================
+// Runs real callables submitted at runtime on N worker threads, ordered by
+// the same policies as CPUScheduler. Each worker owns a run queue (a heap
+// guarded by its own small lock) and parks on its own condition variable.
+// Submitters spread tasks across workers, idle workers steal from busy ones,
+// and a wakeup locks only the one sleeper it claims, so no lock is shared by
+// all threads on the dispatch path.
+//
+// A task is either a plain callable that runs to completion, or a sliced
+// callable where each call is one slice and returning true asks for more.
+// Slice boundaries are the preemption points: SRTF and preemptive priority
+// requeue after every slice, Round Robin after timeQuantum slices, and the
+// multilevel interactive queue after interactiveQuantum slices. Callables
+// may be move-only (a packaged_task hands its result back via a future). A
+// task that throws counts as completed with failed set; its worker carries on.
+//
+// Times are steady_clock nanoseconds. Metrics follow calculateMetrics():
+// turnaround = completion - arrival, waiting = turnaround - burst (time
+// actually spent running) and response = first start - arrival.
+struct TaskMetrics {
+    uint64_t id;
+    int priority;
+    int64_t arrivalTime;
+    int64_t startTime;
+    int64_t completionTime;
+    int64_t burstTime;
+    int64_t turnaroundTime;
+    int64_t waitingTime;
+    int64_t responseTime;
+    bool failed;                // The task threw; it is not retried
+};
+
+struct DispatcherConfig {
+    SchedulerConfig policy;
+    int workers;                // 0 = one per hardware thread
+    int64_t agingIntervalNs;    // Waiting this long is worth one priority level
+    function<void(const TaskMetrics&)> onComplete;   // Optional, runs on the worker thread, must not throw
+
+    DispatcherConfig(SchedulerConfig schedulerPolicy = SchedulerConfig(Algorithm::FCFS), int threads = 0,
+                     int64_t agingNs = 1000000)
+        : policy(schedulerPolicy), workers(threads), agingIntervalNs(agingNs) {}
+};
+
+class Dispatcher {
+private:
+    // Move-only type erasure for task bodies: unlike function<bool()> it
+    // accepts callables that own a unique_ptr or a packaged_task. Small
+    // callables live inline, larger ones are boxed on the heap.
+    class StepFunction {
+    private:
+        static constexpr size_t INLINE_BYTES = 48;
+
+        struct Callable {
+            virtual ~Callable() {}
+            virtual bool call() = 0;
+            virtual Callable* moveTo(void* storage) = 0;
+        };
+
+        template<typename F>
+        struct Inline : Callable {
+            F body;
+            explicit Inline(F&& f) : body(move(f)) {}
+            bool call() override { return body(); }
+            Callable* moveTo(void* storage) override { return new (storage) Inline(move(body)); }
+        };
+
+        template<typename F>
+        struct Boxed : Callable {
+            unique_ptr<F> body;
+            explicit Boxed(F&& f) : body(new F(move(f))) {}
+            explicit Boxed(unique_ptr<F>&& b) : body(move(b)) {}
+            bool call() override { return (*body)(); }
+            Callable* moveTo(void* storage) override { return new (storage) Boxed(move(body)); }
+        };
+
+        template<typename F>
+        using HolderFor = typename conditional<sizeof(Inline<F>) <= INLINE_BYTES &&
+                                               alignof(Inline<F>) <= alignof(max_align_t) &&
+                                               is_nothrow_move_constructible<F>::value,
+                                               Inline<F>, Boxed<F>>::type;
+
+        alignas(max_align_t) unsigned char storage[INLINE_BYTES];
+        Callable* callable = nullptr;
+
+    public:
+        StepFunction() {}
+
+        template<typename F, typename = typename enable_if<!is_same<typename decay<F>::type, StepFunction>::value>::type>
+        StepFunction(F f) {
+            callable = new (storage) HolderFor<F>(move(f));
+        }
+
+        StepFunction(StepFunction&& other) noexcept {
+            *this = move(other);
+        }
+
+        StepFunction& operator=(StepFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                if (other.callable) {
+                    callable = other.callable->moveTo(storage);
+                    other.reset();
+                }
+            }
+            return *this;
+        }
+
+        ~StepFunction() {
+            reset();
+        }
+
+        bool operator()() {
+            return callable->call();
+        }
+
+        void reset() {
+            if (callable) callable->~Callable();
+            callable = nullptr;
+        }
+    };
+
+    struct Task {
+        StepFunction step;
+        int64_t key;            // Policy order, lowest runs first
+        uint64_t id;
+        int priority;
+        int64_t estimate;       // Estimated total burst
+        int64_t arrivalTime;
+        int64_t startTime;      // -1 until first dispatched
+        int64_t burstTime;      // Time spent running so far
+    };
+
+    // Heap order: lowest key first, then lowest id
+    struct Later {
+        bool operator()(const Task& a, const Task& b) const {
+            return a.key != b.key ? a.key > b.key : a.id > b.id;
+        }
+    };
+
+    struct alignas(64) Worker {
+        mutex lock;                 // Guards ready and nextId
+        vector<Task> ready;
+        uint64_t nextId = 0;
+        atomic<size_t> size{0};     // Mirrors ready.size() for lock-free peeking
+        atomic<uint64_t> submitted{0};
+        atomic<uint64_t> completed{0};  // Includes failed tasks
+        atomic<uint64_t> failed{0};
+        mutable mutex statsLock;
+        StreamingStats stats;
+        mutex parkLock;             // Only the worker itself and whoever wakes it
+        condition_variable parked;
+        atomic<bool> sleeping{false};   // Cleared by the waker that claims it
+        thread runner;
+    };
+
+    static constexpr size_t STEAL_BATCH = 32;
+
+    DispatcherConfig config;
+    vector<unique_ptr<Worker>> workers;
+    atomic<bool> closed;            // Set by shutdown(): outside submissions are rejected
+    atomic<int> outsideSubmits;     // Outside submissions past the closed check
+    atomic<bool> stopping;          // Workers exit once this is set and the queues drain
+
+    // Number of parked workers, so submitters skip the wakeup scan when
+    // everyone is busy
+    atomic<int> sleepers;
+
+    struct WorkerIdentity {
+        const Dispatcher* owner = nullptr;
+        int index = 0;
+        unsigned cursor = 0;    // Next worker for tasks submitted from outside
+    };
+
+    static WorkerIdentity& identity() {
+        static thread_local WorkerIdentity id;
+        return id;
+    }
+
+    static int64_t now() {
+        return chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static void calculateMetrics(TaskMetrics& m) {
+        m.turnaroundTime = m.completionTime - m.arrivalTime;
+        m.waitingTime = m.turnaroundTime - m.burstTime;
+    }
+
+    int level(int priority) const {
+        const MultilevelConfig& mlq = config.policy.multilevel;
+        if (priority <= mlq.systemMaxPriority) return 0;
+        if (priority <= mlq.interactiveMaxPriority) return 1;
+        return 2;
+    }
+
+    // Priority-based keys are virtual deadlines: enqueue time plus one aging
+    // interval per priority level. A task that has waited k intervals beats
+    // a fresh task k levels more urgent, so nothing starves.
+    int64_t keyFor(const Task& task, int64_t enqueueTime) const {
+        switch (config.policy.algorithm) {
+            case Algorithm::FCFS: return task.arrivalTime;
+            case Algorithm::SJF: return task.estimate;
+            case Algorithm::SRTF: return max<int64_t>(0, task.estimate - task.burstTime);
+            case Algorithm::PRIORITY_NON_PREEMPTIVE:
+                return task.arrivalTime + task.priority * config.agingIntervalNs;
+            case Algorithm::PRIORITY_PREEMPTIVE:
+                return enqueueTime + task.priority * config.agingIntervalNs;
+            case Algorithm::ROUND_ROBIN: return enqueueTime;
+            case Algorithm::MULTILEVEL_QUEUE:
+                return enqueueTime + level(task.priority) * config.agingIntervalNs;
+        }
+        return enqueueTime;
+    }
+
+    // Slices to run before requeueing; 0 runs the task to completion
+    int sliceLimit(const Task& task) const {
+        switch (config.policy.algorithm) {
+            case Algorithm::SRTF:
+            case Algorithm::PRIORITY_PREEMPTIVE: return 1;
+            case Algorithm::ROUND_ROBIN: return max(1, config.policy.timeQuantum);
+            case Algorithm::MULTILEVEL_QUEUE:
+                return level(task.priority) == 1 ? max(1, config.policy.multilevel.interactiveQuantum) : 0;
+            default: return 0;
+        }
+    }
+
+    // Fresh tasks get an id that is unique without any shared counter:
+    // the worker's own sequence number interleaved with its index
+    uint64_t push(int target, Task&& task, int64_t enqueueTime, bool fresh) {
+        Worker& worker = *workers[target];
+        task.key = keyFor(task, enqueueTime);
+        lock_guard<mutex> guard(worker.lock);
+        if (fresh) {
+            task.id = worker.nextId++ * workers.size() + target;
+            worker.submitted.fetch_add(1, memory_order_relaxed);
+        }
+        uint64_t id = task.id;
+        worker.ready.push_back(move(task));
+        push_heap(worker.ready.begin(), worker.ready.end(), Later());
+        worker.size.store(worker.ready.size());
+        return id;
+    }
+
+    bool popLocal(Worker& worker, Task& task) {
+        if (worker.size.load(memory_order_relaxed) == 0) return false;
+        lock_guard<mutex> guard(worker.lock);
+        if (worker.ready.empty()) return false;
+        pop_heap(worker.ready.begin(), worker.ready.end(), Later());
+        task = move(worker.ready.back());
+        worker.ready.pop_back();
+        worker.size.store(worker.ready.size());
+        return true;
+    }
+
+    // Takes up to half of a victim's queue (best tasks first): one to run
+    // now, the rest into our own queue
+    bool steal(int self, Task& task) {
+        vector<Task> loot;
+        int count = workers.size();
+        for (int offset = 1; offset < count && loot.empty(); offset++) {
+            Worker& victim = *workers[(self + offset) % count];
+            if (victim.size.load(memory_order_relaxed) == 0) continue;
+            lock_guard<mutex> guard(victim.lock);
+            size_t take = min(STEAL_BATCH, (victim.ready.size() + 1) / 2);
+            for (size_t i = 0; i < take; i++) {
+                pop_heap(victim.ready.begin(), victim.ready.end(), Later());
+                loot.push_back(move(victim.ready.back()));
+                victim.ready.pop_back();
+            }
+            victim.size.store(victim.ready.size());
+        }
+        if (loot.empty()) return false;
+
+        task = move(loot[0]);
+        if (loot.size() > 1) {
+            Worker& mine = *workers[self];
+            lock_guard<mutex> guard(mine.lock);
+            for (size_t i = 1; i < loot.size(); i++) {
+                mine.ready.push_back(move(loot[i]));
+                push_heap(mine.ready.begin(), mine.ready.end(), Later());
+            }
+            mine.size.store(mine.ready.size());
+            wakeOne(self + 1);
+        }
+        return true;
+    }
+
+    bool anyWork() const {
+        for (const auto& worker : workers) {
+            if (worker->size.load() > 0) return true;
+        }
+        return false;
+    }
+
+    // Sleeps until work shows up; returns false once stopping and drained.
+    // sleeping is published before the final anyWork() check and pushes
+    // publish size before looking for sleepers (all seq_cst), so either the
+    // worker sees the new task or the submitter sees the sleeper.
+    bool park(Worker& worker) {
+        unique_lock<mutex> guard(worker.parkLock);
+        worker.sleeping.store(true);
+        sleepers.fetch_add(1);
+        if (!anyWork() && !stopping.load()) {
+            worker.parked.wait(guard, [&]() { return !worker.sleeping.load() || stopping.load(); });
+        }
+        worker.sleeping.store(false);
+        sleepers.fetch_sub(1);
+        return anyWork() || !stopping.load();
+    }
+
+    // Claims one sleeping worker, starting the scan at from, and wakes it.
+    // Claiming clears its flag, so concurrent wakeups pick different workers.
+    void wakeOne(int from) {
+        if (sleepers.load() == 0) return;
+        int count = workers.size();
+        for (int offset = 0; offset < count; offset++) {
+            Worker& worker = *workers[(from + offset) % count];
+            bool expected = true;
+            if (worker.sleeping.load() && worker.sleeping.compare_exchange_strong(expected, false)) {
+                { lock_guard<mutex> guard(worker.parkLock); }
+                worker.parked.notify_one();
+                return;
+            }
+        }
+    }
+
+    void run(Worker& worker, int self, Task& task) {
+        int64_t start = now();
+        if (task.startTime < 0) task.startTime = start;
+
+        int limit = sliceLimit(task);
+        bool more = true;
+        bool failed = false;
+        try {
+            for (int slices = 0; more && (limit == 0 || slices < limit); slices++) {
+                more = task.step();
+            }
+        } catch (...) {
+            more = false;
+            failed = true;
+        }
+        int64_t end = now();
+        task.burstTime += end - start;
+
+        if (more) {
+            push(self, move(task), end, false);
+            return;
+        }
+
+        TaskMetrics m;
+        m.id = task.id;
+        m.priority = task.priority;
+        m.arrivalTime = task.arrivalTime;
+        m.startTime = task.startTime;
+        m.completionTime = end;
+        m.burstTime = task.burstTime;
+        m.responseTime = task.startTime - task.arrivalTime;
+        m.failed = failed;
+        calculateMetrics(m);
+        {
+            lock_guard<mutex> guard(worker.statsLock);
+            worker.stats.record(m.turnaroundTime, m.waitingTime, m.responseTime);
+        }
+        if (config.onComplete) config.onComplete(m);
+        if (failed) worker.failed.fetch_add(1, memory_order_relaxed);
+        worker.completed.store(worker.completed.load(memory_order_relaxed) + 1, memory_order_release);
+    }
+
+    void workerLoop(int self) {
+        WorkerIdentity& id = identity();
+        id.owner = this;
+        id.index = self;
+        Worker& worker = *workers[self];
+        Task task;
+        while (true) {
+            if (popLocal(worker, task) || steal(self, task)) {
+                run(worker, self, task);
+                task.step.reset();
+            } else if (!park(worker)) {
+                return;
+            }
+        }
+    }
+
+    uint64_t enqueueNew(StepFunction step, int priority, int64_t estimatedBurstNs) {
+        Task task;
+        task.step = move(step);
+        task.priority = priority;
+        task.estimate = estimatedBurstNs;
+        task.arrivalTime = now();
+        task.startTime = -1;
+        task.burstTime = 0;
+
+        // A running task's spawns are part of the work shutdown() drains, so
+        // only outside threads are turned away. They register before checking
+        // closed, and shutdown() waits for them before it lets workers exit.
+        WorkerIdentity& id = identity();
+        bool outside = id.owner != this;
+        if (outside) {
+            outsideSubmits.fetch_add(1);
+            if (closed.load()) {
+                outsideSubmits.fetch_sub(1);
+                return REJECTED;
+            }
+        }
+
+        // Workers keep their own spawns local; outside threads rotate
+        int target = outside ? (int)(id.cursor++ % workers.size()) : id.index;
+        int64_t arrival = task.arrivalTime;
+        uint64_t taskId = push(target, move(task), arrival, true);
+        wakeOne(target);
+        if (outside) outsideSubmits.fetch_sub(1);
+        return taskId;
+    }
+
+public:
+    explicit Dispatcher(const DispatcherConfig& dispatcherConfig = DispatcherConfig())
+        : config(dispatcherConfig), closed(false), outsideSubmits(0), stopping(false), sleepers(0) {
+        int count = config.workers > 0 ? config.workers : max(1u, thread::hardware_concurrency());
+        for (int i = 0; i < count; i++) {
+            workers.push_back(unique_ptr<Worker>(new Worker()));
+        }
+        for (int i = 0; i < count; i++) {
+            workers[i]->runner = thread(&Dispatcher::workerLoop, this, i);
+        }
+    }
+
+    Dispatcher(const Dispatcher&) = delete;
+    Dispatcher& operator=(const Dispatcher&) = delete;
+
+    ~Dispatcher() {
+        shutdown();
+    }
+
+    // Returned instead of a task id once shutdown() has started; the task is
+    // dropped without being counted, so waitIdle() is unaffected
+    static constexpr uint64_t REJECTED = UINT64_MAX;
+
+    // Runs task() once. Returns the task id reported in TaskMetrics, or
+    // REJECTED when called from outside the dispatcher after shutdown().
+    template<typename F>
+    uint64_t submit(F task, int priority = 0, int64_t estimatedBurstNs = 0) {
+        return enqueueNew([task = move(task)]() mutable { task(); return false; }, priority, estimatedBurstNs);
+    }
+
+    // Calls step() once per slice until it returns false. Same return value
+    // as submit().
+    template<typename F>
+    uint64_t submitSliced(F step, int priority = 0, int64_t estimatedBurstNs = 0) {
+        return enqueueNew(StepFunction(move(step)), priority, estimatedBurstNs);
+    }
+
+    // Blocks until every task submitted before the call has completed
+    void waitIdle() const {
+        while (true) {
+            uint64_t completed = 0, submitted = 0;
+            for (const auto& worker : workers) completed += worker->completed.load(memory_order_acquire);
+            for (const auto& worker : workers) submitted += worker->submitted.load(memory_order_acquire);
+            if (completed == submitted) return;
+            this_thread::sleep_for(chrono::microseconds(50));
+        }
+    }
+
+    // Stops accepting outside submissions, finishes all queued work (and
+    // whatever it spawns), then stops the workers
+    void shutdown() {
+        if (closed.exchange(true)) return;
+        while (outsideSubmits.load() > 0) this_thread::yield();
+        stopping.store(true);
+        for (auto& worker : workers) {
+            { lock_guard<mutex> guard(worker->parkLock); }
+            worker->parked.notify_one();
+        }
+        for (auto& worker : workers) {
+            if (worker->runner.joinable()) worker->runner.join();
+        }
+    }
+
+    int workerCount() const {
+        return workers.size();
+    }
+
+    uint64_t completedCount() const {
+        uint64_t completed = 0;
+        for (const auto& worker : workers) completed += worker->completed.load(memory_order_acquire);
+        return completed;
+    }
+
+    // Tasks whose body threw, also counted in completedCount()
+    uint64_t failedCount() const {
+        uint64_t failed = 0;
+        for (const auto& worker : workers) failed += worker->failed.load(memory_order_relaxed);
+        return failed;
+    }
+
+    // Live snapshot of the turnaround/waiting/response distributions
+    StreamingStats stats() const {
+        StreamingStats merged;
+        for (const auto& worker : workers) {
+            lock_guard<mutex> guard(worker->statsLock);
+            merged.merge(worker->stats);
+        }
+        return merged;
+    }
 };
 
 // ==================== MAIN FUNCTION ====================
+// Define SCHEDULER_NO_MAIN to include this file from another program
+#ifndef SCHEDULER_NO_MAIN
 int main() {
     cout << "=== CPU SCHEDULING ALGORITHMS PROJECT ===" << endl;
     
@@ -609,7 +1655,83 @@ int main() {
     
     scheduler.multilevelQueue();
     
+    // What-if sweep: every algorithm plus a grid of quanta and queue boundaries
+    vector<SchedulerConfig> grid = {
+        SchedulerConfig(Algorithm::FCFS),
+        SchedulerConfig(Algorithm::SJF),
+        SchedulerConfig(Algorithm::SRTF),
+        SchedulerConfig(Algorithm::PRIORITY_NON_PREEMPTIVE),
+        SchedulerConfig(Algorithm::PRIORITY_PREEMPTIVE)
+    };
+    for (int quantum = 1; quantum <= 5; quantum++) {
+        grid.push_back(SchedulerConfig(Algorithm::ROUND_ROBIN, quantum));
+    }
+    grid.push_back(SchedulerConfig(Algorithm::MULTILEVEL_QUEUE, 0, MultilevelConfig(1, 3, 2)));
+    grid.push_back(SchedulerConfig(Algorithm::MULTILEVEL_QUEUE, 0, MultilevelConfig(0, 2, 1)));
+    grid.push_back(SchedulerConfig(Algorithm::MULTILEVEL_QUEUE, 0, MultilevelConfig(1, 4, 4)));
+    CPUScheduler::displaySweep(scheduler.sweep(grid));
+    
+    // Streaming mode: same workload replayed from a binary trace file
+    cout << "\n=== STREAMING MODE ===" << endl;
+    if (!writeTrace("processes.trace", processes)) {
+        cout << "Cannot write trace file: processes.trace" << endl;
+    }
+    CPUScheduler streamingScheduler;
+    {
+        TraceReader trace("processes.trace");
+        streamingScheduler.fcfs(trace);
+    }
+    {
+        TraceReader trace("processes.trace");
+        GanttSpill gantt("processes.gantt");
+        streamingScheduler.roundRobin(trace, 3, &gantt);
+        if (!gantt.close()) {
+            cout << "Gantt spill truncated: processes.gantt" << endl;
+        }
+    }
+    {
+        TraceReader trace("processes.trace");
+        streamingScheduler.multilevelQueue(trace);
+    }
+    
+    cout << "\nSpilled Round Robin Gantt Chart:" << endl;
+    {
+        RecordReader<GanttEntry> gantt("processes.gantt");
+        while (gantt.hasNext()) {
+            GanttEntry entry = gantt.next();
+            cout << "P" << entry.pid << " [" << entry.startTime << ", " << entry.endTime << ")" << endl;
+        }
+    }
+    remove("processes.trace");
+    remove("processes.gantt");
+    
+    // Online dispatch: real tasks on worker threads under the multilevel policy
+    cout << "\n=== ONLINE DISPATCHER ===" << endl;
+    {
+        Dispatcher dispatcher(DispatcherConfig(SchedulerConfig(Algorithm::MULTILEVEL_QUEUE), 4));
+        atomic<long long> checksum(0);
+        const int taskCount = 100000;
+        for (int i = 0; i < taskCount; i++) {
+            dispatcher.submit([&checksum, i]() { checksum += i; }, i % 6, 1000);
+        }
+        dispatcher.waitIdle();
+        cout << "Workers: " << dispatcher.workerCount() << ", tasks completed: " << dispatcher.completedCount()
+             << ", checksum " << (checksum == (long long)taskCount * (taskCount - 1) / 2 ? "OK" : "WRONG") << endl;
+        dispatcher.stats().display("MLQ DISPATCHER (ns)");
+
+        // Tasks may be move-only: a packaged_task returns its result via a
+        // future, and a task that throws is counted as failed
+        packaged_task<long long()> total([&checksum]() { return checksum.load(); });
+        future<long long> result = total.get_future();
+        dispatcher.submit(move(total));
+        dispatcher.submit([]() { throw runtime_error("task failed"); });
+        cout << "Result via future: " << result.get() << endl;
+        dispatcher.waitIdle();
+        cout << "Failed tasks: " << dispatcher.failedCount() << endl;
+    }
+    
     cout << "\n=== ALL SCHEDULING ALGORITHMS COMPLETED ===" << endl;
     
     return 0;
 }
+#endif
@@ -0,0 +1,195 @@
+// Benchmark driver for the CPUScheduler algorithms in scheduling_alog.c++
+//
+//   g++ -std=c++17 -O2 -pthread -o scheduling_benchmark scheduling_benchmark.c++
+//   ./scheduling_benchmark --max 1e6 --json scheduling.json
+//
+// The distribution controls the burst lengths of the generated workload.
+#define SCHEDULER_NO_MAIN
+#include "scheduling_alog.c++"
+#include "benchmark.h"
+
+// Round Robin and Multilevel Queue rescan every process after each slice
+const size_t QUADRATIC_LIMIT = 10000;
+const size_t EVENT_DRIVEN_LIMIT = 10000000;
+const size_t STREAMING_LIMIT = 100000000;
+const size_t DISPATCH_LIMIT = 10000000;
+
+static const vector<Distribution> BURST_DISTRIBUTIONS = {
+    Distribution::RANDOM, Distribution::SORTED, Distribution::REVERSE_SORTED, Distribution::DUPLICATE_HEAVY
+};
+
+static function<size_t(Distribution)> upTo(size_t limit) {
+    return [limit](Distribution) { return limit; };
+}
+
+// n processes arriving in order, bursts 1..100 shaped by the distribution.
+// Inter-arrival gaps average slightly above the mean burst, so the system is
+// loaded but the ready set does not grow without bound. burstScale multiplies
+// both bursts and gaps: same schedule shape, longer time units.
+// Processes are produced one at a time (the key stream matches generateKeys),
+// so a trace of any length can be written in constant memory.
+class WorkloadGenerator {
+private:
+    size_t n;
+    size_t i;
+    Distribution d;
+    int burstScale;
+    mt19937 keyRng;
+    mt19937 rng;
+    int64_t arrival;
+
+public:
+    WorkloadGenerator(size_t count, Distribution dist, int scale = 1)
+        : n(count), i(0), d(dist), burstScale(scale), keyRng(42), rng(11), arrival(0) {}
+
+    Process next() {
+        int burst;
+        switch (d) {
+            case Distribution::SORTED: burst = 1 + (int)(i * 100 / n); break;
+            case Distribution::REVERSE_SORTED: burst = 100 - (int)(i * 100 / n); break;
+            case Distribution::DUPLICATE_HEAVY: burst = 10 * (1 + (int)(keyRng() % 16) % 2); break;
+            default: burst = 1 + (int)(keyRng() & 0x7fffffff) % 100; break;
+        }
+        Process p(i + 1, arrival, (int64_t)burst * burstScale, rng() % 6);
+        arrival += (int64_t)(rng() % 104) * burstScale;
+        i++;
+        return p;
+    }
+};
+
+static vector<Process> generateWorkload(size_t n, Distribution d, int burstScale = 1) {
+    WorkloadGenerator generator(n, d, burstScale);
+    vector<Process> processes;
+    processes.reserve(n);
+    for (size_t i = 0; i < n; i++) processes.push_back(generator.next());
+    return processes;
+}
+
+static Benchmark offlineBenchmark(const string& name, SchedulerConfig config, size_t limit) {
+    return {name, BURST_DISTRIBUTIONS, upTo(limit),
+        [config](BenchState& state) {
+            CPUScheduler scheduler(generateWorkload(state.n, state.distribution));
+            vector<SweepResult> results;
+            state.time([&]() {
+                results = scheduler.sweep({config}, 1);
+            });
+            state.ops = state.n;
+            consume(results[0].makespan);
+        }};
+}
+
+// The event-driven engine should cost the same per process whatever the
+// burst length: rows of equal n should match across scales.
+static Benchmark burstScaleBenchmark(const string& name, SchedulerConfig config, int burstScale) {
+    return {name + "_burst_x" + to_string(burstScale), {Distribution::RANDOM}, upTo(EVENT_DRIVEN_LIMIT),
+        [config, burstScale](BenchState& state) {
+            CPUScheduler scheduler(generateWorkload(state.n, state.distribution, burstScale));
+            vector<SweepResult> results;
+            state.time([&]() {
+                results = scheduler.sweep({config}, 1);
+            });
+            state.ops = state.n;
+            consume(results[0].makespan);
+        }};
+}
+
+// Streaming runs read from a trace file written in setup, before peak RSS
+// is reset, so the reported memory is the streaming scheduler's alone
+static const string STREAMING_TRACE = "scheduling_benchmark.trace";
+
+template<typename Run>
+static Benchmark streamingBenchmark(const string& name, Run run) {
+    Benchmark bench = {name, BURST_DISTRIBUTIONS, upTo(STREAMING_LIMIT),
+        [run](BenchState& state) {
+            CPUScheduler scheduler;
+            state.time([&]() {
+                TraceReader trace(STREAMING_TRACE);
+                run(scheduler, trace);
+            });
+            state.ops = state.n;
+        }};
+    bench.setup = [](size_t n, Distribution d) {
+        WorkloadGenerator generator(n, d);
+        TraceWriter writer(STREAMING_TRACE);
+        for (size_t i = 0; i < n; i++) {
+            Process p = generator.next();
+            writer.write(TraceRecord{p.pid, p.priority, p.arrivalTime, p.burstTime});
+        }
+        if (!writer.close()) {
+            cout << "Cannot write trace file: " << STREAMING_TRACE << endl;
+            exit(1);
+        }
+    };
+    bench.teardown = []() { remove(STREAMING_TRACE.c_str()); };
+    return bench;
+}
+
+// Online dispatch of n empty tasks on one worker per hardware thread. With
+// fanOut, 64 root tasks each submit their share from inside a worker, which
+// keeps submissions on the workers' own queues; otherwise this thread
+// submits everything.
+static Benchmark dispatcherBenchmark(const string& name, SchedulerConfig policy, bool fanOut) {
+    return {name, {Distribution::RANDOM}, upTo(DISPATCH_LIMIT),
+        [policy, fanOut](BenchState& state) {
+            Dispatcher dispatcher{DispatcherConfig(policy)};
+            atomic<size_t> ran(0);
+            size_t n = state.n;
+            state.time([&]() {
+                if (fanOut) {
+                    const size_t roots = 64;
+                    for (size_t r = 0; r < roots; r++) {
+                        size_t share = n / roots + (r < n % roots ? 1 : 0);
+                        dispatcher.submit([&dispatcher, &ran, share, r]() {
+                            for (size_t i = 0; i < share; i++) {
+                                dispatcher.submit([&ran]() { ran.fetch_add(1, memory_order_relaxed); },
+                                                  (int)((r + i) % 6), (int64_t)(i % 100));
+                            }
+                        });
+                    }
+                } else {
+                    for (size_t i = 0; i < n; i++) {
+                        dispatcher.submit([&ran]() { ran.fetch_add(1, memory_order_relaxed); },
+                                          (int)(i % 6), (int64_t)(i % 100));
+                    }
+                }
+                dispatcher.waitIdle();
+            });
+            state.ops = n;
+            StreamingStats stats = dispatcher.stats();
+            state.report("p50_response_ns", (double)stats.responseHistogram().percentile(0.50));
+            state.report("p99_response_ns", (double)stats.responseHistogram().percentile(0.99));
+            consume(ran.load());
+        }};
+}
+
+static vector<Benchmark> schedulingBenchmarks() {
+    vector<Benchmark> benchmarks = {
+        offlineBenchmark("fcfs", SchedulerConfig(Algorithm::FCFS), EVENT_DRIVEN_LIMIT),
+        offlineBenchmark("sjf", SchedulerConfig(Algorithm::SJF), EVENT_DRIVEN_LIMIT),
+        offlineBenchmark("srtf", SchedulerConfig(Algorithm::SRTF), EVENT_DRIVEN_LIMIT),
+        offlineBenchmark("priority_np", SchedulerConfig(Algorithm::PRIORITY_NON_PREEMPTIVE), EVENT_DRIVEN_LIMIT),
+        offlineBenchmark("priority_p", SchedulerConfig(Algorithm::PRIORITY_PREEMPTIVE), EVENT_DRIVEN_LIMIT),
+        offlineBenchmark("round_robin_q4", SchedulerConfig(Algorithm::ROUND_ROBIN, 4), QUADRATIC_LIMIT),
+        offlineBenchmark("multilevel", SchedulerConfig(Algorithm::MULTILEVEL_QUEUE), QUADRATIC_LIMIT),
+        streamingBenchmark("stream_fcfs", [](CPUScheduler& s, TraceReader& t) { s.fcfs(t); }),
+        streamingBenchmark("stream_rr_q4", [](CPUScheduler& s, TraceReader& t) { s.roundRobin(t, 4); }),
+        streamingBenchmark("stream_multilevel", [](CPUScheduler& s, TraceReader& t) { s.multilevelQueue(t); }),
+        dispatcherBenchmark("dispatch_fcfs", SchedulerConfig(Algorithm::FCFS), false),
+        dispatcherBenchmark("dispatch_srtf", SchedulerConfig(Algorithm::SRTF), false),
+        dispatcherBenchmark("dispatch_priority_p", SchedulerConfig(Algorithm::PRIORITY_PREEMPTIVE), false),
+        dispatcherBenchmark("dispatch_rr_q4", SchedulerConfig(Algorithm::ROUND_ROBIN, 4), false),
+        dispatcherBenchmark("dispatch_multilevel", SchedulerConfig(Algorithm::MULTILEVEL_QUEUE), false),
+        dispatcherBenchmark("dispatch_fanout_fcfs", SchedulerConfig(Algorithm::FCFS), true),
+        dispatcherBenchmark("dispatch_fanout_multilevel", SchedulerConfig(Algorithm::MULTILEVEL_QUEUE), true)
+    };
+    for (int scale : {1, 1000, 1000000}) {
+        benchmarks.push_back(burstScaleBenchmark("sjf", SchedulerConfig(Algorithm::SJF), scale));
+        benchmarks.push_back(burstScaleBenchmark("srtf", SchedulerConfig(Algorithm::SRTF), scale));
+        benchmarks.push_back(burstScaleBenchmark("priority_p", SchedulerConfig(Algorithm::PRIORITY_PREEMPTIVE), scale));
+    }
+    return benchmarks;
+}
+
+int main(int argc, char** argv) {
+    return runBenchmarks(schedulingBenchmarks(), argc, argv);
+}